@@ -0,0 +1,33 @@
+# Compiles a single source file and fails when the compile takes longer than the budget.
+# Expects COMPILER, FLAGS, INCLUDE_DIR, SOURCE and BUDGET_MS (in milliseconds) to be defined on the command line.
+# The timestamps need CMake 3.23 for sub-second resolution.
+
+foreach(VAR COMPILER INCLUDE_DIR SOURCE BUDGET_MS)
+	if(NOT DEFINED ${VAR})
+		message(FATAL_ERROR "compile-budget.cmake requires ${VAR} to be defined!")
+	endif()
+endforeach()
+
+# A compile stuck far past the budget is stopped instead of holding up the build.
+math(EXPR TIMEOUT_SECONDS "${BUDGET_MS} * 4 / 1000 + 1")
+
+# Seconds followed by microseconds, so the difference is in microseconds.
+string(TIMESTAMP START_TIME "%s%f" UTC)
+execute_process(
+	COMMAND "${COMPILER}" ${FLAGS} "-I${INCLUDE_DIR}" "${SOURCE}"
+	RESULT_VARIABLE COMPILE_RESULT
+	OUTPUT_VARIABLE COMPILE_OUTPUT
+	ERROR_VARIABLE COMPILE_OUTPUT
+	TIMEOUT ${TIMEOUT_SECONDS}
+)
+string(TIMESTAMP END_TIME "%s%f" UTC)
+math(EXPR ELAPSED_MS "(${END_TIME} - ${START_TIME}) / 1000")
+
+if(NOT COMPILE_RESULT EQUAL 0)
+	message(FATAL_ERROR "Compile of ${SOURCE} failed or timed out (${COMPILE_RESULT}):\n${COMPILE_OUTPUT}")
+endif()
+if(ELAPSED_MS GREATER BUDGET_MS)
+	message(FATAL_ERROR "Compiled ${SOURCE} in ${ELAPSED_MS}ms, over the budget of ${BUDGET_MS}ms!")
+endif()
+
+message(STATUS "Compiled ${SOURCE} in ${ELAPSED_MS}ms, budget is ${BUDGET_MS}ms")
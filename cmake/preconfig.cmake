@@ -1,4 +1 @@
-
-if(NOT TARGET ez::meta)
-	find_dependency(ez-meta CONFIG)
-endif()
\ No newline at end of file
+# ez-iterator is header only, and has no dependencies to find.
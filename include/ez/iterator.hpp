@@ -1,5 +1,10 @@
 #pragma once
 
+// The lightweight core of the library. The remaining features depend on heavier standard headers,
+// so they are only available through their own headers, or all at once from <ez/iterator/all.hpp>
 #include "iterator/enumerate.hpp"
 #include "iterator/range.hpp"
-#include "iterator/adapt.hpp"
\ No newline at end of file
+#include "iterator/adapt.hpp"
+#include "iterator/windows.hpp"
+#include "iterator/strided.hpp"
+#include "iterator/chunks.hpp"
@@ -3,18 +3,20 @@
 #include <cstddef>
 // various static inspection functions
 #include <type_traits>
-// For the iterator categories
-#include <iterator>
-// For std::addressof
-#include <memory>
 
 #include "intern/helpers.hpp"
 
 namespace ez {
-	// Do we still need this?
+	namespace intern {
+		// Evaluated lazily inside std::conjunction, so the result type is only formed once the call is known to be valid.
+		template<typename Functor, typename Arg>
+		struct returns_no_rvalue : std::bool_constant<!std::is_rvalue_reference_v<std::invoke_result_t<Functor, Arg>>> {};
+	};
+
+	// Steps an arbitrary random access iterator by Inc elements at a time, see ez::strided for contiguous storage.
 	template<typename Iter, std::ptrdiff_t Inc>
 	struct offset_adaptor: public Iter {
-		static_assert(ez::is_random_iterator_v<Iter>, "ez::offset_adaptor requires a random access iterator!");
+		static_assert(intern::is_random_iterator_v<Iter>, "ez::offset_adaptor requires a random access iterator!");
 
 		using Iter::Iter;
 
@@ -24,7 +26,7 @@ namespace ez {
 		};
 		offset_adaptor operator++(int) {
 			offset_adaptor copy = *this;
-			++copy;
+			++(*this);
 			return copy;
 		};
 
@@ -34,7 +36,7 @@ namespace ez {
 		};
 		offset_adaptor operator--(int) {
 			offset_adaptor copy = *this;
-			--copy;
+			--(*this);
 			return copy;
 		};
 	};
@@ -45,19 +47,23 @@ namespace ez {
 		using functor_t = Functor;
 		using parent_t = Iter;
 
-		static_assert(ez::is_iterator_v<parent_t>, "ez::functor_adaptor requires an iterator type!");
-		using parent_value_type = ez::iterator_value_t<parent_t>;
-		using parent_pointer = parent_value_type*;
-		using parent_reference = parent_value_type&;
-		using iterator_category = ez::extract_iterator_category_t<parent_t>;
 		using parent_deref_type = decltype(std::declval<parent_t>().operator*());
 
-		static_assert(std::is_default_constructible_v<functor_t>, "ez::functor_adaptor requires a default constructible functor!");
-		static_assert(std::is_nothrow_copy_constructible_v<parent_t>, "ez::functor_adaptor requires a nothrow copy constructible iterator type!");
-		static_assert(std::is_invocable_v<functor_t, parent_deref_type>, "ez::functor_adaptor requires an invokable object type!");
+		// A single check, so every instantiation only pays for one assertion.
+		static_assert(std::conjunction_v<
+				intern::is_iterator<parent_t>,
+				std::is_nothrow_copy_constructible<parent_t>,
+				std::is_default_constructible<functor_t>,
+				std::is_invocable<functor_t, parent_deref_type>,
+				intern::returns_no_rvalue<functor_t, parent_deref_type>>,
+			"ez::functor_adaptor requires a nothrow copy constructible iterator, and a default constructible functor invokable with its elements that does not return an rvalue reference!");
+
+		using parent_value_type = intern::iterator_value_t<parent_t>;
+		using parent_pointer = parent_value_type*;
+		using parent_reference = parent_value_type&;
+		using iterator_category = intern::extract_iterator_category_t<parent_t>;
 
 		using ret_type = decltype(functor_t{}(std::declval<parent_deref_type>()));
-		static_assert(!std::is_rvalue_reference_v<ret_type>, "Returning rvalue references from an iterator adaptor is not supported!");
 		static constexpr bool is_reference = std::is_lvalue_reference_v<ret_type>;
 
 		functor_adaptor(const parent_t& source)
@@ -86,7 +92,7 @@ namespace ez {
 		pointer operator->() {
 			// Only return an actual pointer type if the return type has an actual address
 			if constexpr (is_reference) {
-				return std::addressof(functor_t{}(parent_t::operator*()));
+				return intern::address_of(functor_t{}(parent_t::operator*()));
 			}
 			else {
 				return functor_t{}(parent_t::operator*());
@@ -100,32 +106,31 @@ namespace ez {
 		using functor_t = Functor;
 		using parent_t = Iter;
 
-		static_assert(ez::is_iterator_v<parent_t>, "ez::lambda_adaptor requires an iterator type!");
-		using parent_value_type = ez::iterator_value_t<parent_t>;
+		// We have to get the exact type resulting from dereferencing the iterator, to make sure the invocation check works
+		using parent_deref_type = decltype(std::declval<parent_t>().operator*());
+
+		// Not all lambdas are trivially movable, it depends on the captured parameters.
+		// I don't know what kind of use case rvalues would even have for returning from an adaptor.
+		// If you truely want that, just return lvalue and call std::move
+		static_assert(std::conjunction_v<
+				intern::is_iterator<parent_t>,
+				std::is_trivially_move_constructible<functor_t>,
+				std::is_invocable<functor_t, parent_deref_type>,
+				intern::returns_no_rvalue<functor_t, parent_deref_type>>,
+			"ez::lambda_adaptor requires an iterator, and a trivially movable lambda invokable with its elements that does not return an rvalue reference! "
+			"Trivially movable means that all captured variables must also be trivially movable.");
+
+		using parent_value_type = intern::iterator_value_t<parent_t>;
 		using parent_pointer = parent_value_type*;
 		using parent_reference = parent_value_type&;
 
 		// We can only support forward iteration at best, because we have to take ownership of the lambda.
 		// This will hopefully prevent people from trying to reverse the range.
 		using iterator_category = 
-			std::conditional_t<std::is_same_v<ez::extract_iterator_category_t<parent_t>, std::input_iterator_tag>,
+			std::conditional_t<std::is_same_v<intern::extract_iterator_category_t<parent_t>, std::input_iterator_tag>,
 			std::input_iterator_tag, std::forward_iterator_tag>;
 
-		// We have to get the exact type resulting from dereferencing the iterator, to make sure the later invocation check works
-		using parent_deref_type = decltype(std::declval<parent_t>().operator*());
-
-		// Not all lambdas are trivially movable, it depends on the captured parameters.
-		static_assert(std::is_trivially_move_constructible_v<Functor>, 
-			"ez::lambda_adaptor requires a trivially movable lambda! This means that all captured variables must also be trivially movable.");
-		
-		// Make sure that the lambda can actually be called with the iterators return type.
-		static_assert(std::is_invocable_v<functor_t, parent_deref_type>, "ez::lambda_adaptor requires a lambda invokable with the type returned from the iterator!");
-
 		using ret_type = decltype(std::declval<functor_t>()(std::declval<parent_deref_type>()));
-		
-		// I don't know what kind of use case rvalues would even have for returning from an adaptor.
-		// If you truely want that, just return lvalue and call std::move
-		static_assert(!std::is_rvalue_reference_v<ret_type>, "Returning rvalue references from an iterator adaptor is not supported!");
 		static constexpr bool is_reference = std::is_lvalue_reference_v<ret_type>;
 
 		using value_type = std::remove_reference_t<ret_type>;
@@ -144,7 +149,7 @@ namespace ez {
 		pointer operator->() {
 			// Only return an actual pointer type if the return type has an actual address
 			if constexpr (is_reference) {
-				return std::addressof(func(parent_t::operator*()));
+				return intern::address_of(func(parent_t::operator*()));
 			}
 			else {
 				return func(parent_t::operator*());
@@ -157,7 +162,7 @@ namespace ez {
 	// Adapt an iterator using a functor type directly (instead of passing a functor object into the function)
 	template<typename Functor, typename T>
 	auto adapt(T& obj) {
-		if constexpr (ez::is_iterator_v<T>) {
+		if constexpr (intern::is_iterator_v<T>) {
 			return functor_adaptor<T, Functor>(obj);
 		}
 		else {
@@ -173,7 +178,7 @@ namespace ez {
 	// Adapt using a lambda or an actual functor object instance. This form of adapt takes ownership of the functor passed in.
 	template<typename T, typename Functor>
 	auto adapt(T& obj, Functor&& func) {
-		if constexpr (ez::is_iterator_v<T>) {
+		if constexpr (intern::is_iterator_v<T>) {
 			return lambda_adaptor<T, Functor>(obj, std::move(func));
 		}
 		else {
@@ -189,5 +194,5 @@ namespace ez {
 	};
 
 	template<typename iterator>
-	using deref_adaptor = functor_adaptor<iterator, typename intern::deref_functor<iterator_value_t<iterator>>>;
+	using deref_adaptor = functor_adaptor<iterator, typename intern::deref_functor<intern::iterator_value_t<iterator>>>;
 };
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "../iterator.hpp"
+#include "collect.hpp"
+#include "ndrange.hpp"
+#include "shared_cursor.hpp"
+#include "set_bits.hpp"
+#include "merge.hpp"
+#include "any_range.hpp"
@@ -0,0 +1,210 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+// For placement new
+#include <new>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		template<typename T>
+		class any_range_concept {
+		public:
+			virtual ~any_range_concept() = default;
+
+			// Copy up to count elements into out, returns the number of elements written.
+			virtual std::size_t pull(T* out, std::size_t count) = 0;
+
+			// Move construct this object into storage, returning the new object.
+			virtual any_range_concept* move_to(void* storage) noexcept = 0;
+		};
+
+		template<typename T, typename Iter0, typename Iter1>
+		class any_range_model final : public any_range_concept<T> {
+		public:
+			any_range_model(const Iter0& _iter, const Iter1& _last)
+				: iter(_iter)
+				, last(_last)
+			{}
+			any_range_model(any_range_model&&) = default;
+
+			std::size_t pull(T* out, std::size_t count) override {
+				std::size_t i = 0;
+				for (; i < count && iter != last; ++i, ++iter) {
+					out[i] = *iter;
+				}
+				return i;
+			}
+
+			any_range_concept<T>* move_to(void* storage) noexcept override {
+				return new (storage) any_range_model(std::move(*this));
+			}
+		private:
+			Iter0 iter;
+			Iter1 last;
+		};
+	};
+
+	/*
+	Type erased single pass range of T, able to hold any ez range or adaptor.
+	Iterators that fit in the inline buffer are stored without allocating.
+	Pulling elements in batches with next_batch pays for the virtual call once per batch instead of once per element.
+	Only the iterators are stored, so the source of the range must outlive the any_range.
+	*/
+	template<typename T, std::size_t Capacity = 64>
+	class any_range {
+	public:
+		static_assert(std::is_default_constructible_v<T>, "ez::any_range requires a default constructible value type!");
+
+		using value_type = T;
+		using size_type = std::size_t;
+
+		class iterator {
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using reference = T&;
+			using pointer = T*;
+			using iterator_category = std::input_iterator_tag;
+
+			iterator() noexcept
+				: source(nullptr)
+				, current()
+				, valid(false)
+			{}
+			iterator(any_range* _source)
+				: source(_source)
+				, current()
+				, valid(false)
+			{
+				++(*this);
+			}
+
+			reference operator*() noexcept {
+				return current;
+			}
+			pointer operator->() noexcept {
+				return &current;
+			}
+
+			iterator& operator++() {
+				valid = source->next_batch(&current, 1) == 1;
+				return *this;
+			}
+			void operator++(int) {
+				++(*this);
+			}
+
+			bool operator==(const iterator& other) const noexcept {
+				return valid == other.valid;
+			}
+			bool operator!=(const iterator& other) const noexcept {
+				return valid != other.valid;
+			}
+		private:
+			any_range* source;
+			T current;
+			bool valid;
+		};
+
+		any_range() noexcept
+			: impl(nullptr)
+			, local(false)
+		{}
+
+		template<typename Range, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Range>, any_range>>>
+		any_range(Range&& range)
+			: impl(nullptr)
+			, local(false)
+		{
+			using range_t = std::remove_reference_t<Range>;
+			using model_t = intern::any_range_model<T, intern::range_iterator_t<range_t>, intern::range_sentinel_t<range_t>>;
+
+			if constexpr (sizeof(model_t) <= Capacity && alignof(model_t) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<model_t>) {
+				impl = new (buffer) model_t(range.begin(), range.end());
+				local = true;
+			}
+			else {
+				impl = new model_t(range.begin(), range.end());
+			}
+		}
+
+		any_range(any_range&& other) noexcept
+			: impl(nullptr)
+			, local(false)
+		{
+			take(other);
+		}
+		any_range& operator=(any_range&& other) noexcept {
+			if (this != &other) {
+				reset();
+				take(other);
+			}
+			return *this;
+		}
+		any_range(const any_range&) = delete;
+		any_range& operator=(const any_range&) = delete;
+
+		~any_range() {
+			reset();
+		}
+
+		// Copy up to count elements into out, returns the number of elements written. Zero means the range is exhausted.
+		size_type next_batch(T* out, size_type count) {
+			if (impl == nullptr) {
+				return 0;
+			}
+			return impl->pull(out, count);
+		}
+
+		// Fill a contiguous container (like a span or a vector) with as many elements as possible.
+		template<typename Span>
+		size_type next_batch(Span&& span) {
+			return next_batch(span.data(), static_cast<size_type>(span.size()));
+		}
+
+		iterator begin() {
+			return iterator{ this };
+		}
+		iterator end() noexcept {
+			return iterator{};
+		}
+
+		// Whether the erased iterators were stored inline, without allocating.
+		bool is_inline() const noexcept {
+			return local;
+		}
+	private:
+		void reset() noexcept {
+			if (impl != nullptr) {
+				if (local) {
+					impl->~any_range_concept();
+				}
+				else {
+					delete impl;
+				}
+			}
+			impl = nullptr;
+			local = false;
+		}
+
+		void take(any_range& other) noexcept {
+			if (other.local) {
+				impl = other.impl->move_to(buffer);
+				local = true;
+				other.reset();
+			}
+			else {
+				impl = other.impl;
+				other.impl = nullptr;
+			}
+		}
+
+		alignas(std::max_align_t) unsigned char buffer[Capacity];
+		intern::any_range_concept<T>* impl;
+		bool local;
+	};
+};
@@ -0,0 +1,187 @@
+#pragma once
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		/*
+		Splits a range into consecutive chunks of at most n elements, each chunk is a simple_range of the source iterator.
+		Random access sources compute the chunk boundaries directly, so the chunk iterator is random access as well.
+		Forward sources find the end of each chunk while advancing, so the source is only traversed once.
+		*/
+		template<typename Iter, bool = is_random_iterator_v<Iter>>
+		class chunk_iterator {
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = simple_range<Iter>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::random_access_iterator_tag;
+
+			chunk_iterator() = default;
+			chunk_iterator(const Iter& _first, difference_type _count, difference_type _chunk, difference_type _index) noexcept
+				: first(_first)
+				, count(_count)
+				, chunk(_chunk)
+				, index(_index)
+			{}
+
+			value_type operator*() const noexcept {
+				return (*this)[0];
+			}
+			value_type operator->() const noexcept {
+				return (*this)[0];
+			}
+			value_type operator[](difference_type offset) const noexcept {
+				difference_type start = (index + offset) * chunk;
+				difference_type stop = (count - start) > chunk ? start + chunk : count;
+				return value_type{ first + start, first + stop };
+			}
+
+			chunk_iterator& operator++() noexcept {
+				++index;
+				return *this;
+			}
+			chunk_iterator operator++(int) noexcept {
+				chunk_iterator copy = *this;
+				++index;
+				return copy;
+			}
+			chunk_iterator& operator--() noexcept {
+				--index;
+				return *this;
+			}
+			chunk_iterator operator--(int) noexcept {
+				chunk_iterator copy = *this;
+				--index;
+				return copy;
+			}
+
+			chunk_iterator& operator+=(difference_type offset) noexcept {
+				index += offset;
+				return *this;
+			}
+			chunk_iterator& operator-=(difference_type offset) noexcept {
+				index -= offset;
+				return *this;
+			}
+			chunk_iterator operator+(difference_type offset) const noexcept {
+				return chunk_iterator{ first, count, chunk, index + offset };
+			}
+			chunk_iterator operator-(difference_type offset) const noexcept {
+				return chunk_iterator{ first, count, chunk, index - offset };
+			}
+			difference_type operator-(const chunk_iterator& other) const noexcept {
+				return index - other.index;
+			}
+
+			bool operator==(const chunk_iterator& other) const noexcept {
+				return index == other.index;
+			}
+			bool operator!=(const chunk_iterator& other) const noexcept {
+				return index != other.index;
+			}
+			bool operator<(const chunk_iterator& other) const noexcept {
+				return index < other.index;
+			}
+			bool operator<=(const chunk_iterator& other) const noexcept {
+				return index <= other.index;
+			}
+			bool operator>(const chunk_iterator& other) const noexcept {
+				return index > other.index;
+			}
+			bool operator>=(const chunk_iterator& other) const noexcept {
+				return index >= other.index;
+			}
+		private:
+			Iter first;
+			difference_type count, chunk, index;
+		};
+
+		template<typename Iter>
+		class chunk_iterator<Iter, false> {
+		public:
+			static_assert(is_forward_iterator_v<Iter>, "ez::chunks requires at least a forward iterator!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = simple_range<Iter>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::forward_iterator_tag;
+
+			chunk_iterator() = default;
+			chunk_iterator(const Iter& _first, const Iter& _last, difference_type _chunk) noexcept
+				: first(_first)
+				, next(_first)
+				, last(_last)
+				, chunk(_chunk)
+			{
+				advance();
+			}
+
+			value_type operator*() const noexcept {
+				return value_type{ first, next };
+			}
+			value_type operator->() const noexcept {
+				return value_type{ first, next };
+			}
+
+			chunk_iterator& operator++() {
+				first = next;
+				advance();
+				return *this;
+			}
+			chunk_iterator operator++(int) {
+				chunk_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const chunk_iterator& other) const noexcept {
+				return first == other.first;
+			}
+			bool operator!=(const chunk_iterator& other) const noexcept {
+				return first != other.first;
+			}
+		private:
+			void advance() {
+				for (difference_type i = 0; i < chunk && next != last; ++i) {
+					++next;
+				}
+			}
+
+			Iter first, next, last;
+			difference_type chunk;
+		};
+	};
+
+	// Split a container into consecutive chunks of at most 'size' elements, the last chunk holds whatever remains.
+	template<typename Container>
+	auto chunks(Container&& container, std::size_t size) {
+		using container_t = std::remove_reference_t<Container>;
+		using container_iterator_t = intern::range_iterator_t<container_t>;
+		using chunk_t = intern::chunk_iterator<container_iterator_t>;
+
+		assert(size > 0 && "ez::chunks requires a chunk size of at least one!");
+		std::ptrdiff_t chunk = static_cast<std::ptrdiff_t>(size);
+
+		if constexpr (intern::is_random_iterator_v<container_iterator_t>) {
+			std::ptrdiff_t count = static_cast<std::ptrdiff_t>(intern::range_size(container));
+			return intern::simple_range<chunk_t>{
+				chunk_t{ container.begin(), count, chunk, 0 },
+				chunk_t{ container.begin(), count, chunk, (count + chunk - 1) / chunk }
+			};
+		}
+		else {
+			return intern::simple_range<chunk_t>{
+				chunk_t{ container.begin(), container.end(), chunk },
+				chunk_t{ container.end(), container.end(), chunk }
+			};
+		}
+	}
+};
@@ -0,0 +1,176 @@
+#pragma once
+// For std::size_t and std::max_align_t
+#include <cstddef>
+// For std::uintptr_t
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+// For placement new
+#include <new>
+#include <memory>
+#include <vector>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	/*
+	Simple bump allocator. Allocations are carved out of large blocks and are never freed individually,
+	everything allocated from the arena is released at once by calling release() or destroying the arena.
+	Destructors are never run on objects placed in the arena.
+	*/
+	class arena {
+	public:
+		static constexpr std::size_t default_block_size = 4096;
+
+		explicit arena(std::size_t _block_size = default_block_size) noexcept
+			: block_size(_block_size)
+			, head(nullptr)
+			, remaining(0)
+		{}
+		arena(const arena&) = delete;
+		// The moved from arena must not keep bumping into a block it no longer owns.
+		arena(arena&& other) noexcept
+			: blocks(std::move(other.blocks))
+			, block_size(other.block_size)
+			, head(std::exchange(other.head, nullptr))
+			, remaining(std::exchange(other.remaining, 0))
+		{
+			other.blocks.clear();
+		}
+		~arena() = default;
+
+		arena& operator=(const arena&) = delete;
+		arena& operator=(arena&& other) noexcept {
+			if (this != &other) {
+				blocks = std::move(other.blocks);
+				block_size = other.block_size;
+				head = std::exchange(other.head, nullptr);
+				remaining = std::exchange(other.remaining, 0);
+				other.blocks.clear();
+			}
+			return *this;
+		}
+
+		void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+			std::size_t padding = (align - (reinterpret_cast<std::uintptr_t>(head) & (align - 1))) & (align - 1);
+			if (head == nullptr || (padding + bytes) > remaining) {
+				// Oversized requests get a block of their own.
+				std::size_t size = bytes + align > block_size ? bytes + align : block_size;
+				blocks.emplace_back(new unsigned char[size]);
+				head = blocks.back().get();
+				remaining = size;
+				padding = (align - (reinterpret_cast<std::uintptr_t>(head) & (align - 1))) & (align - 1);
+			}
+
+			unsigned char* result = head + padding;
+			head = result + bytes;
+			remaining -= padding + bytes;
+			return result;
+		}
+
+		template<typename T>
+		T* allocate_array(std::size_t count) {
+			return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		// Free every allocation made from this arena.
+		void release() noexcept {
+			blocks.clear();
+			head = nullptr;
+			remaining = 0;
+		}
+
+		std::size_t num_blocks() const noexcept {
+			return blocks.size();
+		}
+	private:
+		std::vector<std::unique_ptr<unsigned char[]>> blocks;
+		std::size_t block_size;
+		unsigned char* head;
+		std::size_t remaining;
+	};
+
+	namespace intern {
+		template<typename Range>
+		using range_value_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<range_iterator_t<Range>&>())>>;
+
+		template<typename Container, typename = void>
+		struct has_reserve : std::false_type {};
+
+		template<typename Container>
+		struct has_reserve<Container, std::void_t<decltype(std::declval<Container&>().reserve(std::size_t(0)))>> : std::true_type {};
+
+		template<typename Container, typename = void>
+		struct has_push_back : std::false_type {};
+
+		template<typename Container>
+		struct has_push_back<Container, std::void_t<decltype(std::declval<Container&>().push_back(std::declval<typename Container::value_type>()))>> : std::true_type {};
+	};
+
+	// Materialize a range into a container. When the size of the range is known up front the container is only allocated once.
+	template<typename Container, typename Range>
+	Container collect(Range&& range) {
+		using range_t = std::remove_reference_t<Range>;
+
+		Container result;
+		if constexpr (intern::is_sized_range_v<range_t> && intern::has_reserve<Container>::value) {
+			result.reserve(intern::range_size(range));
+		}
+
+		auto last = range.end();
+		for (auto iter = range.begin(); iter != last; ++iter) {
+			if constexpr (intern::has_push_back<Container>::value) {
+				result.push_back(*iter);
+			}
+			else {
+				result.insert(result.end(), *iter);
+			}
+		}
+		return result;
+	}
+
+	// Materialize a range into memory owned by an arena. The returned range is valid until the arena is released.
+	// Sized ranges are placed with a single allocation, others grow geometrically within the arena.
+	template<typename Range>
+	auto collect_into(Range&& range, arena& storage) {
+		using range_t = std::remove_reference_t<Range>;
+		using value_t = intern::range_value_t<range_t>;
+
+		static_assert(std::is_trivially_destructible_v<value_t>, "ez::collect_into requires a trivially destructible value type, the arena never runs destructors!");
+
+		auto iter = range.begin();
+		auto last = range.end();
+
+		if constexpr (intern::is_sized_range_v<range_t>) {
+			std::size_t count = intern::range_size(range);
+			value_t* data = storage.allocate_array<value_t>(count);
+			value_t* out = data;
+			value_t* out_last = data + count;
+
+			// Bounded by the allocation as well, so a range reporting the wrong size can never write past it.
+			for (; iter != last && out != out_last; ++iter, ++out) {
+				new (out) value_t(*iter);
+			}
+
+			return intern::simple_range<value_t*>{ data, out };
+		}
+		else {
+			std::size_t count = 0, capacity = 16;
+			value_t* data = storage.allocate_array<value_t>(capacity);
+			for (; iter != last; ++iter, ++count) {
+				if (count == capacity) {
+					// The old buffer is simply abandoned, it gets freed along with the rest of the arena.
+					value_t* grown = storage.allocate_array<value_t>(capacity * 2);
+					for (std::size_t i = 0; i < count; ++i) {
+						new (grown + i) value_t(std::move(data[i]));
+					}
+					data = grown;
+					capacity *= 2;
+				}
+				new (data + count) value_t(*iter);
+			}
+
+			return intern::simple_range<value_t*>{ data, data + count };
+		}
+	}
+};
@@ -1,7 +1,9 @@
-#include <ez/meta.hpp>
+#pragma once
 #include <cinttypes>
 #include <cassert>
 
+#include "intern/helpers.hpp"
+
 namespace ez {
 	namespace intern {
 		/*
@@ -11,13 +13,14 @@ namespace ez {
 		class enumerate_iterator {
 		public:
 			static constexpr bool
-				at_least_bidirectional = ez::is_bidirectional_iterator_v<Iter>,
-				at_least_random = ez::is_random_iterator_v<Iter>;
+				at_least_bidirectional = is_bidirectional_iterator_v<Iter>,
+				at_least_random = is_random_iterator_v<Iter>;
 
 			static_assert(!reversed || (reversed && at_least_bidirectional), "Reversed enumeration requires at least a bidirectional iterator!");
 
-			using utype = ez::iterator_value_t<Iter>;
-			using utype_reference = utype&;
+			using utype = iterator_value_t<Iter>;
+			// Iterators that produce values (like ez::range) are enumerated by value, everything else by reference.
+			using utype_reference = decltype(*std::declval<Iter&>());
 			using utype_pointer = utype*;
 
 			using size_type = std::size_t;
@@ -26,7 +29,7 @@ namespace ez {
 				utype_reference value;
 				difference_type index;
 			};
-			using iterator_category = ez::extract_iterator_category_t<Iter>;
+			using iterator_category = extract_iterator_category_t<Iter>;
 			using reference = value_type&;
 			using pointer = value_type*;
 
@@ -86,7 +89,7 @@ namespace ez {
 				return copy;
 			}
 
-			template<typename = std::enable_if_t<at_least_bidirectional>>
+			template<bool B = at_least_bidirectional, typename = std::enable_if_t<B>>
 			enumerate_iterator& operator--() {
 				if constexpr (reversed) {
 					++iter;
@@ -99,8 +102,8 @@ namespace ez {
 				
 				return *this;
 			}
-			template<typename = std::enable_if_t<at_least_bidirectional>>
-			enumerate_iterator& operator--(int) {
+			template<bool B = at_least_bidirectional, typename = std::enable_if_t<B>>
+			enumerate_iterator operator--(int) {
 				enumerate_iterator copy = *this;
 				if constexpr (reversed) {
 					++(*this);
@@ -119,29 +122,29 @@ namespace ez {
 				return index != other.index;
 			}
 
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			bool operator<(const enumerate_iterator& other) const noexcept {
 				return index < other.index;
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			bool operator<=(const enumerate_iterator& other) const noexcept {
 				return index <= other.index;
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			bool operator>(const enumerate_iterator& other) const noexcept {
 				return index > other.index;
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			bool operator>=(const enumerate_iterator& other) const noexcept {
 				return index >= other.index;
 			}
 
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			difference_type operator-(enumerate_iterator other) const {
 				return index - other.index;
 			}
 
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			enumerate_iterator operator+(difference_type offset) const {
 				if constexpr (reversed) {
 					offset = -offset;
@@ -149,7 +152,7 @@ namespace ez {
 
 				return enumerate_iterator{iter + offset, index + offset};
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			enumerate_iterator operator-(difference_type offset) const {
 				if constexpr (reversed) {
 					offset = -offset;
@@ -157,7 +160,7 @@ namespace ez {
 
 				return enumerate_iterator{ iter - offset, index - offset };
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			enumerate_iterator& operator+=(difference_type offset) {
 				if constexpr (reversed) {
 					offset = -offset;
@@ -168,7 +171,7 @@ namespace ez {
 
 				return *this;
 			}
-			template<typename = std::enable_if_t<at_least_random>>
+			template<bool B = at_least_random, typename = std::enable_if_t<B>>
 			enumerate_iterator& operator-=(difference_type offset) {
 				if constexpr (reversed) {
 					offset = -offset;
@@ -193,13 +196,13 @@ namespace ez {
 		using container_t = std::remove_reference_t<Container>;
 		using container_iterator_t = decltype(container.begin());
 
-		static_assert(ez::is_forward_iterator_v<container_iterator_t>, "ez::enumerate requires at least a forward iterator!");
+		static_assert(intern::is_forward_iterator_v<container_iterator_t>, "ez::enumerate requires at least a forward iterator!");
 
 		using enumerator_t = intern::enumerate_iterator<container_iterator_t>;
 		
 		return intern::simple_range<enumerator_t>{
 			enumerator_t{container.begin(), 0},
-			enumerator_t{container.end(), static_cast<std::ptrdiff_t>(container.size())}
+			enumerator_t{container.end(), static_cast<std::ptrdiff_t>(intern::range_distance(container))}
 		};
 	}
 
@@ -209,12 +212,12 @@ namespace ez {
 		using container_t = std::remove_reference_t<Container>;
 		using container_iterator_t = decltype(container.begin());
 		
-		static_assert(ez::is_bidirectional_iterator_v<container_iterator_t>, "ez::renumerate requires at least a bidirectional iterator!");
+		static_assert(intern::is_bidirectional_iterator_v<container_iterator_t>, "ez::renumerate requires at least a bidirectional iterator!");
 
 		using enumerator_t = intern::enumerate_iterator<container_iterator_t, true>;
 
 		return intern::simple_range<enumerator_t>{
-			enumerator_t{ container.end(), static_cast<std::ptrdiff_t>(container.size()) - 1 },
+			enumerator_t{ container.end(), static_cast<std::ptrdiff_t>(intern::range_distance(container)) - 1 },
 				enumerator_t{ container.begin(), -1 },
 		};
 	}
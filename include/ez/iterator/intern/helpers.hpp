@@ -1,7 +1,10 @@
 #pragma once
-#include <ez/meta.hpp>
 #include <cinttypes>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+
+#include "traits.hpp"
 
 namespace ez {
 	namespace intern {
@@ -22,18 +25,17 @@ namespace ez {
 		// Simple range type, just takes two (possibly differently typed) iterators and returns then as begin and end.
 		template<typename Iter0, typename Iter1 = Iter0>
 		struct simple_range {
-			static_assert(ez::is_iterator_v<Iter0>, "ez::intern::simple_range requires an iterator type!");
-			static_assert(ez::is_iterator_v<Iter1>, "ez::intern::simple_range requires an iterator type!");
-			static_assert(std::is_nothrow_copy_constructible_v<Iter0>, "ez::intern::simple_range requires a nothrow copy constructible iterator type!");
-			static_assert(std::is_nothrow_copy_constructible_v<Iter1>, "ez::intern::simple_range requires a nothrow copy constructible iterator type!");
+			static_assert(is_iterator_v<Iter0> && is_iterator_v<Iter1>, "ez::intern::simple_range requires an iterator type!");
 
-			template<typename = std::enable_if_t<std::is_nothrow_move_constructible_v<Iter0> && std::is_nothrow_move_constructible_v<Iter1>>>
+			// Dependent on I0 and I1, so iterators that may throw when moved fall back to the copying constructor instead of failing to compile.
+			template<typename I0 = Iter0, typename I1 = Iter1, typename = std::enable_if_t<std::is_nothrow_move_constructible_v<I0> && std::is_nothrow_move_constructible_v<I1>>>
 			simple_range(Iter0&& _first, Iter1&& _last) noexcept
 				: first(std::move(_first))
 				, last(std::move(_last))
 			{};
 
-			constexpr simple_range(const Iter0& _first, const Iter1& _last) noexcept
+			// Iterators that own storage (like the runtime sized ez::merge_all) may throw when copied.
+			constexpr simple_range(const Iter0& _first, const Iter1& _last) noexcept(std::is_nothrow_copy_constructible_v<Iter0> && std::is_nothrow_copy_constructible_v<Iter1>)
 				: first(_first)
 				, last(_last)
 			{};
@@ -47,6 +49,62 @@ namespace ez {
 			Iter1 end() noexcept {
 				return last;
 			}
+
+			bool empty() const {
+				return !(first != last);
+			}
+
+			// Only random access ranges can report their size without walking the iterators.
+			template<typename I = Iter0, typename = std::enable_if_t<is_random_iterator_v<I> && std::is_same_v<I, Iter1>>>
+			std::size_t size() const {
+				return static_cast<std::size_t>(last - first);
+			}
+
+			template<typename I = Iter0, typename = std::enable_if_t<is_random_iterator_v<I>>>
+			decltype(auto) operator[](std::ptrdiff_t offset) const {
+				return first[offset];
+			}
 		};
+
+		template<typename Range, typename = void>
+		struct has_size_member : std::false_type {};
+
+		template<typename Range>
+		struct has_size_member<Range, std::void_t<decltype(std::declval<Range&>().size())>> : std::true_type {};
+
+		template<typename Range>
+		using range_iterator_t = decltype(std::declval<Range&>().begin());
+
+		template<typename Range>
+		using range_sentinel_t = decltype(std::declval<Range&>().end());
+
+		// True when the number of elements in the range can be found in constant time.
+		template<typename Range>
+		inline constexpr bool is_sized_range_v = 
+			has_size_member<Range>::value ||
+			(is_random_iterator_v<range_iterator_t<Range>> && std::is_same_v<range_iterator_t<Range>, range_sentinel_t<Range>>);
+
+		template<typename Range>
+		std::size_t range_size(Range& range) {
+			static_assert(is_sized_range_v<Range>, "ez::intern::range_size requires a sized range!");
+
+			if constexpr (has_size_member<Range>::value) {
+				return static_cast<std::size_t>(range.size());
+			}
+			else {
+				return static_cast<std::size_t>(range.end() - range.begin());
+			}
+		}
+
+		// Number of elements in the range, walking the iterators when the size is not known up front.
+		template<typename Range>
+		std::size_t range_distance(Range& range) {
+			if constexpr (is_sized_range_v<Range>) {
+				return range_size(range);
+			}
+			else {
+				return static_cast<std::size_t>(std::distance(range.begin(), range.end()));
+			}
+		}
 	};
 };
\ No newline at end of file
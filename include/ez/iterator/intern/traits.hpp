@@ -0,0 +1,53 @@
+#pragma once
+#include <type_traits>
+#include <iterator>
+
+namespace ez {
+	namespace intern {
+		// The handful of iterator traits the library needs, kept here so the headers don't depend on all of ez-meta.
+
+		template<typename T, typename = void>
+		struct is_iterator : std::false_type {};
+
+		template<typename T>
+		struct is_iterator<T, std::void_t<typename std::iterator_traits<T>::iterator_category>> : std::true_type {};
+
+		template<typename T>
+		inline constexpr bool is_iterator_v = is_iterator<T>::value;
+
+		template<typename T>
+		using extract_iterator_category_t = typename std::iterator_traits<T>::iterator_category;
+
+		template<typename T>
+		using iterator_value_t = typename std::iterator_traits<T>::value_type;
+
+		template<typename T, typename Tag, bool = is_iterator_v<T>>
+		inline constexpr bool has_iterator_category_v = false;
+
+		template<typename T, typename Tag>
+		inline constexpr bool has_iterator_category_v<T, Tag, true> = std::is_base_of_v<Tag, extract_iterator_category_t<T>>;
+
+		template<typename T>
+		inline constexpr bool is_forward_iterator_v = has_iterator_category_v<T, std::forward_iterator_tag>;
+
+		template<typename T>
+		inline constexpr bool is_bidirectional_iterator_v = has_iterator_category_v<T, std::bidirectional_iterator_tag>;
+
+		template<typename T>
+		inline constexpr bool is_random_iterator_v = has_iterator_category_v<T, std::random_access_iterator_tag>;
+
+		// Same as std::addressof, without pulling in all of <memory>
+		template<typename T>
+		constexpr T* address_of(T& obj) noexcept {
+			return __builtin_addressof(obj);
+		}
+
+		// Same as std::less<void>, without pulling in all of <functional>
+		struct less {
+			template<typename L, typename R>
+			constexpr bool operator()(const L& lh, const R& rh) const {
+				return lh < rh;
+			}
+		};
+	};
+};
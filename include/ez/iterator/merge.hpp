@@ -0,0 +1,265 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <array>
+#include <vector>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		/*
+		Merges two sorted ranges. The choice of source is computed once per step,
+		and random access sources advance both cursors arithmetically instead of branching.
+		*/
+		template<typename Iter, typename Compare>
+		class merge2_iterator {
+		public:
+			static_assert(is_forward_iterator_v<Iter>, "ez::merge requires at least a forward iterator!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = iterator_value_t<Iter>;
+			using reference = decltype(*std::declval<Iter&>());
+			using pointer = value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			merge2_iterator(const Iter& _a, const Iter& _a_last, const Iter& _b, const Iter& _b_last, const Compare& _comp)
+				: a(_a)
+				, a_last(_a_last)
+				, b(_b)
+				, b_last(_b_last)
+				, comp(_comp)
+			{
+				select();
+			}
+
+			reference operator*() {
+				return take_b ? *b : *a;
+			}
+
+			merge2_iterator& operator++() {
+				if constexpr (is_random_iterator_v<Iter>) {
+					a += difference_type(!take_b);
+					b += difference_type(take_b);
+				}
+				else {
+					if (take_b) {
+						++b;
+					}
+					else {
+						++a;
+					}
+				}
+				select();
+				return *this;
+			}
+			merge2_iterator operator++(int) {
+				merge2_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const merge2_iterator& other) const noexcept {
+				return a == other.a && b == other.b;
+			}
+			bool operator!=(const merge2_iterator& other) const noexcept {
+				return a != other.a || b != other.b;
+			}
+		private:
+			void select() {
+				// Ties go to the first range, which keeps the merge stable.
+				take_b = (b != b_last) && ((a == a_last) || comp(*b, *a));
+			}
+
+			Iter a, a_last, b, b_last;
+			Compare comp;
+			bool take_b;
+		};
+
+		template<typename T, std::size_t K>
+		using merge_storage_t = std::conditional_t<K == 0, std::vector<T>, std::array<T, K>>;
+
+		/*
+		Merges any number of sorted ranges with a loser tree.
+		The internal nodes of the tree hold the source that lost the match at that node, and the overall winner is kept in the first slot.
+		After the winner advances only its path to the root is replayed, so each step takes log(k) comparisons.
+		A K of zero stores the sources in vectors, so the number of sources can be decided at runtime.
+		*/
+		template<typename Iter, std::size_t K, typename Compare>
+		class merge_iterator {
+		public:
+			static_assert(is_forward_iterator_v<Iter>, "ez::merge requires at least a forward iterator!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = iterator_value_t<Iter>;
+			using reference = decltype(*std::declval<Iter&>());
+			using pointer = value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			using cursor_storage = merge_storage_t<Iter, K>;
+			using tree_storage = merge_storage_t<size_type, K>;
+
+			merge_iterator(const cursor_storage& _iters, const cursor_storage& _lasts, const Compare& _comp)
+				: iters(_iters)
+				, lasts(_lasts)
+				, tree{}
+				, comp(_comp)
+				, consumed(0)
+			{
+				build();
+			}
+
+			reference operator*() {
+				return *iters[tree[0]];
+			}
+
+			merge_iterator& operator++() {
+				size_type winner = tree[0];
+				++iters[winner];
+				++consumed;
+
+				for (size_type node = (winner + iters.size()) / 2; node > 0; node /= 2) {
+					if (beats(tree[node], winner)) {
+						std::swap(tree[node], winner);
+					}
+				}
+				tree[0] = winner;
+				return *this;
+			}
+			merge_iterator operator++(int) {
+				merge_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const merge_iterator& other) const noexcept {
+				return done() == other.done() && (done() || consumed == other.consumed);
+			}
+			bool operator!=(const merge_iterator& other) const noexcept {
+				return !(*this == other);
+			}
+		private:
+			bool done() const noexcept {
+				return iters.size() == 0 || !(iters[tree[0]] != lasts[tree[0]]);
+			}
+
+			// True if source 'lh' should be emitted before source 'rh', exhausted sources lose every match.
+			// Ties go to the source that was passed first, which keeps the merge stable like the two way merge.
+			bool beats(size_type lh, size_type rh) {
+				if (iters[rh] == lasts[rh]) {
+					return true;
+				}
+				if (iters[lh] == lasts[lh]) {
+					return false;
+				}
+				return lh < rh ? !comp(*iters[rh], *iters[lh]) : comp(*iters[lh], *iters[rh]);
+			}
+
+			void build() {
+				size_type count = iters.size();
+				if (count == 0) {
+					return;
+				}
+
+				if constexpr (K == 0) {
+					tree.resize(count);
+				}
+
+				// Play the matches bottom up, the leaf for source i sits at count + i.
+				merge_storage_t<size_type, K * 2> winners{};
+				if constexpr (K == 0) {
+					winners.resize(count * 2);
+				}
+				for (size_type i = 0; i < count; ++i) {
+					winners[count + i] = i;
+				}
+				for (size_type node = count - 1; node > 0; --node) {
+					size_type lh = winners[node * 2], rh = winners[node * 2 + 1];
+					if (beats(lh, rh)) {
+						winners[node] = lh;
+						tree[node] = rh;
+					}
+					else {
+						winners[node] = rh;
+						tree[node] = lh;
+					}
+				}
+				tree[0] = winners[1];
+			}
+
+			cursor_storage iters, lasts;
+			tree_storage tree;
+			Compare comp;
+			size_type consumed;
+		};
+
+		template<typename Compare, typename Range, typename... Ranges>
+		auto merge_fixed(Compare comp, Range& first, Ranges&... rest) {
+			using iterator_t = range_iterator_t<Range>;
+			constexpr std::size_t count = sizeof...(Ranges) + 1;
+
+			static_assert(std::is_same_v<iterator_t, range_sentinel_t<Range>>, "ez::merge requires ranges with the same begin and end types!");
+			static_assert((std::is_same_v<iterator_t, range_iterator_t<Ranges>> && ...), "ez::merge requires every range to have the same iterator type!");
+			static_assert((std::is_same_v<iterator_t, range_sentinel_t<Ranges>> && ...), "ez::merge requires ranges with the same begin and end types!");
+
+			if constexpr (count == 2) {
+				using merge_t = merge2_iterator<iterator_t, Compare>;
+				auto& second = (rest, ...);
+
+				return simple_range<merge_t>{
+					merge_t{ first.begin(), first.end(), second.begin(), second.end(), comp },
+					merge_t{ first.end(), first.end(), second.end(), second.end(), comp }
+				};
+			}
+			else {
+				using merge_t = merge_iterator<iterator_t, count, Compare>;
+				typename merge_t::cursor_storage firsts{ first.begin(), rest.begin()... };
+				typename merge_t::cursor_storage lasts{ first.end(), rest.end()... };
+
+				return simple_range<merge_t>{
+					merge_t{ firsts, lasts, comp },
+					merge_t{ lasts, lasts, comp }
+				};
+			}
+		}
+	};
+
+	// Lazily merge several sorted ranges into one sorted range, using a custom comparison.
+	template<typename Compare, typename... Ranges>
+	auto merge_by(Compare comp, Ranges&&... ranges) {
+		static_assert(sizeof...(Ranges) > 0, "ez::merge requires at least one range!");
+		return intern::merge_fixed(comp, ranges...);
+	}
+
+	// Lazily merge several sorted ranges into one sorted range, ordered by operator<
+	template<typename... Ranges>
+	auto merge(Ranges&&... ranges) {
+		return merge_by(intern::less{}, std::forward<Ranges>(ranges)...);
+	}
+
+	// Lazily merge a runtime sized container of sorted ranges into one sorted range.
+	template<typename Container, typename Compare = intern::less>
+	auto merge_all(Container& ranges, Compare comp = {}) {
+		using range_t = typename Container::value_type;
+		using iterator_t = intern::range_iterator_t<range_t>;
+		using merge_t = intern::merge_iterator<iterator_t, 0, Compare>;
+
+		static_assert(std::is_same_v<iterator_t, intern::range_sentinel_t<range_t>>, "ez::merge_all requires ranges with the same begin and end types!");
+
+		typename merge_t::cursor_storage firsts, lasts;
+		firsts.reserve(ranges.size());
+		lasts.reserve(ranges.size());
+		for (auto& range : ranges) {
+			firsts.push_back(range.begin());
+			lasts.push_back(range.end());
+		}
+
+		return intern::simple_range<merge_t>{
+			merge_t{ firsts, lasts, comp },
+			merge_t{ lasts, lasts, comp }
+		};
+	}
+};
@@ -0,0 +1,390 @@
+#pragma once
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+#include <array>
+#include <tuple>
+#include <utility>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		/*
+		Flat iterator over every index in an N dimensional box, visited in row major order (the last dimension changes fastest).
+		Incrementing carries between the dimensions, so only the random access jumps need to divide.
+		*/
+		template<std::size_t N>
+		class ndrange_iterator {
+		public:
+			static_assert(N > 0, "ez::ndrange requires at least one dimension!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::array<std::ptrdiff_t, N>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::random_access_iterator_tag;
+
+			ndrange_iterator() noexcept
+				: extents{}
+				, index{}
+				, flat(0)
+			{}
+			ndrange_iterator(const value_type& _extents, difference_type _flat) noexcept
+				: extents(_extents)
+				, index{}
+				, flat(_flat)
+			{
+				unflatten();
+			}
+
+			value_type operator*() const noexcept {
+				return index;
+			}
+			value_type operator->() const noexcept {
+				return index;
+			}
+			value_type operator[](difference_type offset) const noexcept {
+				return *(*this + offset);
+			}
+
+			ndrange_iterator& operator++() noexcept {
+				++flat;
+				for (std::size_t k = N - 1; k > 0; --k) {
+					if (++index[k] < extents[k]) {
+						return *this;
+					}
+					index[k] = 0;
+				}
+				++index[0];
+				return *this;
+			}
+			ndrange_iterator operator++(int) noexcept {
+				ndrange_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			ndrange_iterator& operator--() noexcept {
+				--flat;
+				for (std::size_t k = N - 1; k > 0; --k) {
+					if (index[k] > 0) {
+						--index[k];
+						return *this;
+					}
+					index[k] = extents[k] - 1;
+				}
+				--index[0];
+				return *this;
+			}
+			ndrange_iterator operator--(int) noexcept {
+				ndrange_iterator copy = *this;
+				--(*this);
+				return copy;
+			}
+
+			ndrange_iterator& operator+=(difference_type offset) noexcept {
+				flat += offset;
+				unflatten();
+				return *this;
+			}
+			ndrange_iterator& operator-=(difference_type offset) noexcept {
+				flat -= offset;
+				unflatten();
+				return *this;
+			}
+			ndrange_iterator operator+(difference_type offset) const noexcept {
+				return ndrange_iterator{ extents, flat + offset };
+			}
+			ndrange_iterator operator-(difference_type offset) const noexcept {
+				return ndrange_iterator{ extents, flat - offset };
+			}
+			difference_type operator-(const ndrange_iterator& other) const noexcept {
+				return flat - other.flat;
+			}
+
+			bool operator==(const ndrange_iterator& other) const noexcept {
+				return flat == other.flat;
+			}
+			bool operator!=(const ndrange_iterator& other) const noexcept {
+				return flat != other.flat;
+			}
+			bool operator<(const ndrange_iterator& other) const noexcept {
+				return flat < other.flat;
+			}
+			bool operator<=(const ndrange_iterator& other) const noexcept {
+				return flat <= other.flat;
+			}
+			bool operator>(const ndrange_iterator& other) const noexcept {
+				return flat > other.flat;
+			}
+			bool operator>=(const ndrange_iterator& other) const noexcept {
+				return flat >= other.flat;
+			}
+
+			// The flat position of the iterator, the index the element would have in a row major array.
+			difference_type position() const noexcept {
+				return flat;
+			}
+		private:
+			void unflatten() noexcept {
+				difference_type remain = flat;
+				for (std::size_t k = N - 1; k > 0; --k) {
+					if (extents[k] == 0) {
+						index = value_type{};
+						return;
+					}
+					index[k] = remain % extents[k];
+					remain /= extents[k];
+				}
+				index[0] = remain;
+			}
+
+			value_type extents, index;
+			difference_type flat;
+		};
+
+		/*
+		Visits every index in an N dimensional box one tile at a time, the tiles themselves are visited in row major order.
+		Tiles on the upper edges are clipped to the extents. This can only be a forward iterator.
+		*/
+		template<std::size_t N>
+		class tiled_ndrange_iterator {
+		public:
+			static_assert(N > 0, "ez::tiled_ndrange requires at least one dimension!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::array<std::ptrdiff_t, N>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::forward_iterator_tag;
+
+			tiled_ndrange_iterator() noexcept
+				: extents{}
+				, tile{}
+				, origin{}
+				, index{}
+				, flat(0)
+			{}
+			tiled_ndrange_iterator(const value_type& _extents, const value_type& _tile, difference_type _flat) noexcept
+				: extents(_extents)
+				, tile(_tile)
+				, origin{}
+				, index{}
+				, flat(_flat)
+			{}
+
+			value_type operator*() const noexcept {
+				return index;
+			}
+			value_type operator->() const noexcept {
+				return index;
+			}
+
+			tiled_ndrange_iterator& operator++() noexcept {
+				++flat;
+
+				// Move within the current tile
+				for (std::size_t k = N; k-- > 0;) {
+					difference_type limit = origin[k] + tile[k];
+					if (limit > extents[k]) {
+						limit = extents[k];
+					}
+
+					if (++index[k] < limit) {
+						return *this;
+					}
+					index[k] = origin[k];
+				}
+
+				// Move to the next tile
+				for (std::size_t k = N; k-- > 0;) {
+					origin[k] += tile[k];
+					if (origin[k] < extents[k]) {
+						index = origin;
+						return *this;
+					}
+					origin[k] = 0;
+				}
+				index = origin;
+				return *this;
+			}
+			tiled_ndrange_iterator operator++(int) noexcept {
+				tiled_ndrange_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const tiled_ndrange_iterator& other) const noexcept {
+				return flat == other.flat;
+			}
+			bool operator!=(const tiled_ndrange_iterator& other) const noexcept {
+				return flat != other.flat;
+			}
+
+			// The number of indices visited so far.
+			difference_type position() const noexcept {
+				return flat;
+			}
+		private:
+			value_type extents, tile, origin, index;
+			difference_type flat;
+		};
+
+		// Flat iterator over the cartesian product of several random access ranges, yielding a tuple with one element from each range.
+		template<typename... Iters>
+		class product_iterator {
+		public:
+			static constexpr std::size_t dimensions = sizeof...(Iters);
+			static_assert((is_random_iterator_v<Iters> && ...), "ez::product requires random access iterators!");
+
+			using index_iterator = ndrange_iterator<dimensions>;
+			using extents_type = typename index_iterator::value_type;
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::tuple<decltype(std::declval<const Iters&>()[0])...>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::random_access_iterator_tag;
+
+			product_iterator(const std::tuple<Iters...>& _firsts, const index_iterator& _iter) noexcept
+				: firsts(_firsts)
+				, iter(_iter)
+			{}
+
+			value_type operator*() const {
+				return deref(*iter, std::index_sequence_for<Iters...>{});
+			}
+			value_type operator->() const {
+				return **this;
+			}
+			value_type operator[](difference_type offset) const {
+				return *(*this + offset);
+			}
+
+			product_iterator& operator++() noexcept {
+				++iter;
+				return *this;
+			}
+			product_iterator operator++(int) noexcept {
+				product_iterator copy = *this;
+				++iter;
+				return copy;
+			}
+			product_iterator& operator--() noexcept {
+				--iter;
+				return *this;
+			}
+			product_iterator operator--(int) noexcept {
+				product_iterator copy = *this;
+				--iter;
+				return copy;
+			}
+
+			product_iterator& operator+=(difference_type offset) noexcept {
+				iter += offset;
+				return *this;
+			}
+			product_iterator& operator-=(difference_type offset) noexcept {
+				iter -= offset;
+				return *this;
+			}
+			product_iterator operator+(difference_type offset) const noexcept {
+				return product_iterator{ firsts, iter + offset };
+			}
+			product_iterator operator-(difference_type offset) const noexcept {
+				return product_iterator{ firsts, iter - offset };
+			}
+			difference_type operator-(const product_iterator& other) const noexcept {
+				return iter - other.iter;
+			}
+
+			bool operator==(const product_iterator& other) const noexcept {
+				return iter == other.iter;
+			}
+			bool operator!=(const product_iterator& other) const noexcept {
+				return iter != other.iter;
+			}
+			bool operator<(const product_iterator& other) const noexcept {
+				return iter < other.iter;
+			}
+			bool operator<=(const product_iterator& other) const noexcept {
+				return iter <= other.iter;
+			}
+			bool operator>(const product_iterator& other) const noexcept {
+				return iter > other.iter;
+			}
+			bool operator>=(const product_iterator& other) const noexcept {
+				return iter >= other.iter;
+			}
+		private:
+			template<std::size_t... Is>
+			value_type deref(const extents_type& index, std::index_sequence<Is...>) const {
+				return value_type{ std::get<Is>(firsts)[index[Is]]... };
+			}
+
+			std::tuple<Iters...> firsts;
+			index_iterator iter;
+		};
+	};
+
+	// Iterate over every index in an N dimensional box, as a single flat random access range of std::array indices.
+	template<std::size_t N>
+	intern::simple_range<intern::ndrange_iterator<N>> ndrange(const std::array<std::ptrdiff_t, N>& extents) noexcept {
+		using iterator_t = intern::ndrange_iterator<N>;
+
+		std::ptrdiff_t total = 1;
+		for (std::ptrdiff_t extent : extents) {
+			total *= extent;
+		}
+
+		return intern::simple_range<iterator_t>{
+			iterator_t{ extents, 0 },
+			iterator_t{ extents, total }
+		};
+	}
+
+	template<typename... Ts>
+	auto ndrange(Ts... extents) noexcept {
+		static_assert((std::is_integral_v<Ts> && ...), "ez::ndrange requires integral extents!");
+		return ndrange(std::array<std::ptrdiff_t, sizeof...(Ts)>{ static_cast<std::ptrdiff_t>(extents)... });
+	}
+
+	// Iterate over every index in an N dimensional box, visiting one tile of the box at a time for better cache locality.
+	template<std::size_t N>
+	intern::simple_range<intern::tiled_ndrange_iterator<N>> tiled_ndrange(const std::array<std::ptrdiff_t, N>& extents, const std::array<std::ptrdiff_t, N>& tile) noexcept {
+		using iterator_t = intern::tiled_ndrange_iterator<N>;
+
+		std::ptrdiff_t total = 1;
+		for (std::size_t k = 0; k < N; ++k) {
+			assert(tile[k] > 0 && "ez::tiled_ndrange requires tiles of at least one element!");
+			total *= extents[k];
+		}
+
+		return intern::simple_range<iterator_t>{
+			iterator_t{ extents, tile, 0 },
+			iterator_t{ extents, tile, total }
+		};
+	}
+
+	// Iterate over the cartesian product of several random access ranges as a single flat random access range.
+	template<typename... Ranges>
+	auto product(Ranges&&... ranges) {
+		static_assert(sizeof...(Ranges) > 0, "ez::product requires at least one range!");
+		static_assert((intern::is_sized_range_v<std::remove_reference_t<Ranges>> && ...), "ez::product requires sized ranges!");
+
+		using iterator_t = intern::product_iterator<intern::range_iterator_t<std::remove_reference_t<Ranges>>...>;
+		using index_range_t = decltype(ndrange(std::declval<typename iterator_t::extents_type>()));
+
+		index_range_t indices = ndrange(typename iterator_t::extents_type{ static_cast<std::ptrdiff_t>(intern::range_size(ranges))... });
+		std::tuple<intern::range_iterator_t<std::remove_reference_t<Ranges>>...> firsts{ ranges.begin()... };
+
+		return intern::simple_range<iterator_t>{
+			iterator_t{ firsts, indices.first },
+			iterator_t{ firsts, indices.last }
+		};
+	}
+};
@@ -2,116 +2,39 @@
 #include <cinttypes>
 #include <type_traits>
 #include <cassert>
-#include <limits>
-#include <stdexcept>
+// For std::terminate
+#include <exception>
 #include "intern/helpers.hpp"
 
 namespace ez {
 	namespace intern {
 		template<typename T, bool = std::is_integral_v<T>>
-		class range_iterator {
-		public:
-			using size_type = typename std::make_unsigned_t<T>;
-			using difference_type = typename std::make_signed_t<T>;
-
-			using value_type = T;
-
-			using reference = value_type&;
-			using pointer = value_type*;
-
-			using iterator_category = std::random_access_iterator_tag;
-
-			constexpr range_iterator(value_type _index, difference_type _inc)
-				: index(_index)
-				, increment(_inc)
-			{}
-			constexpr range_iterator(const range_iterator& other) = default;
-			~range_iterator() = default;
-
-			constexpr range_iterator& operator=(const range_iterator&) = default;
-
-			constexpr value_type operator->() {
-				return index;
-			};
-			constexpr value_type operator*() {
-				return index;
-			};
-
-			range_iterator& operator++() {
-				index += increment;
-				return *this;
-			};
-			range_iterator operator++(int) {
-				range_iterator copy = *this;
-				++(*this);
-				return copy;
-			};
-
-			range_iterator& operator--() {
-				index -= increment;
-				return *this;
-			};
-			range_iterator operator--(int) {
-				range_iterator copy = *this;
-				--(*this);
-				return copy;
-			};
-
-			constexpr range_iterator operator+(difference_type val) const {
-				return range_iterator(index + val * increment);
-			};
-			constexpr range_iterator operator-(difference_type val) const {
-				return range_iterator(index - val * increment);
-			};
-			constexpr difference_type operator-(range_iterator other) const {
-				return index - other.index;
-			};
-
-			range_iterator& operator+=(difference_type val) {
-				index += val * increment;
-				return *this;
-			};
-			range_iterator& operator-=(difference_type val) {
-				index -= val * increment;
-				return *this;
-			};
-
-			constexpr bool operator==(const range_iterator& other) const {
-				return index == other.index;
-			};
-			constexpr bool operator!=(const range_iterator& other) const {
-				return index != other.index;
-			};
-
-			constexpr bool operator<(const range_iterator& other) const {
-				return index < other.index;
-			};
-			constexpr bool operator>(const range_iterator& other) const {
-				return index > other.index;
-			};
+		struct range_types {
+			// At least as wide as std::ptrdiff_t, so the span of any narrower type fits.
+			using difference_type = std::common_type_t<std::ptrdiff_t, std::make_signed_t<T>>;
+			// Unsigned ranges can still step backwards.
+			using step_type = difference_type;
+		};
 
-			constexpr bool operator<=(const range_iterator& other) const {
-				return index <= other.index;
-			};
-			constexpr bool operator>=(const range_iterator& other) const {
-				return index >= other.index;
-			};
+		template<typename T>
+		struct range_types<T, false> {
+			static_assert(std::is_floating_point_v<T>, "ez::range requires an arithmetic type!");
 
-			constexpr value_type operator[](difference_type offset) const {
-				return index + offset * increment;
-			};
-		private:
-			value_type index;
-			difference_type increment;
+			using difference_type = std::ptrdiff_t;
+			using step_type = T;
 		};
 
+		/*
+		The iterator counts the steps taken from the first value, and computes its value from that count.
+		Comparisons only look at the count, so a range stops after a whole number of steps whatever its span.
+		*/
 		template<typename T>
-		class range_iterator<T, false> {
+		class range_iterator {
 		public:
-			static_assert(std::is_floating_point_v<T>, "ez::range requires an arithmetic type!");
+			using size_type = std::size_t;
+			using difference_type = typename range_types<T>::difference_type;
+			using step_type = typename range_types<T>::step_type;
 
-			using size_type = T;
-			using difference_type = T;
 			using value_type = T;
 
 			using reference = value_type&;
@@ -119,9 +42,10 @@ namespace ez {
 
 			using iterator_category = std::random_access_iterator_tag;
 
-			constexpr range_iterator(T _index, T _inc)
-				: index(_index)
+			constexpr range_iterator(value_type _first, step_type _inc, difference_type _count)
+				: first(_first)
 				, increment(_inc)
+				, count(_count)
 			{}
 			constexpr range_iterator(const range_iterator& other) = default;
 			~range_iterator() = default;
@@ -129,14 +53,14 @@ namespace ez {
 			constexpr range_iterator& operator=(const range_iterator&) = default;
 
 			constexpr value_type operator->() {
-				return index;
+				return (*this)[0];
 			};
 			constexpr value_type operator*() {
-				return index;
+				return (*this)[0];
 			};
 
 			range_iterator& operator++() {
-				index += increment;
+				++count;
 				return *this;
 			};
 			range_iterator operator++(int) {
@@ -146,7 +70,7 @@ namespace ez {
 			};
 
 			range_iterator& operator--() {
-				index -= increment;
+				--count;
 				return *this;
 			};
 			range_iterator operator--(int) {
@@ -156,101 +80,118 @@ namespace ez {
 			};
 
 			constexpr range_iterator operator+(difference_type val) const {
-				return range_iterator(index + val * increment);
+				return range_iterator(first, increment, count + val);
 			};
 			constexpr range_iterator operator-(difference_type val) const {
-				return range_iterator(index - val * increment);
+				return range_iterator(first, increment, count - val);
 			};
 			constexpr difference_type operator-(range_iterator other) const {
-				return index - other.index;
+				return count - other.count;
 			};
 
 			range_iterator& operator+=(difference_type val) {
-				index += val * increment;
+				count += val;
 				return *this;
 			};
 			range_iterator& operator-=(difference_type val) {
-				index -= val * increment;
+				count -= val;
 				return *this;
 			};
 
 			constexpr bool operator==(const range_iterator& other) const {
-				return index == other.index;
+				return count == other.count;
 			};
 			constexpr bool operator!=(const range_iterator& other) const {
-				return index != other.index;
+				return count != other.count;
 			};
 
 			constexpr bool operator<(const range_iterator& other) const {
-				return index < other.index;
+				return count < other.count;
 			};
 			constexpr bool operator>(const range_iterator& other) const {
-				return index > other.index;
+				return count > other.count;
 			};
 
 			constexpr bool operator<=(const range_iterator& other) const {
-				return index <= other.index;
+				return count <= other.count;
 			};
 			constexpr bool operator>=(const range_iterator& other) const {
-				return index >= other.index;
+				return count >= other.count;
 			};
 
 			constexpr value_type operator[](difference_type offset) const {
-				return index + offset * increment;
+				if constexpr (std::is_integral_v<T>) {
+					// Unsigned arithmetic wraps instead of overflowing, and converting back gives the right value for every T.
+					using unsigned_t = std::make_unsigned_t<difference_type>;
+					return value_type(unsigned_t(first) + unsigned_t(count + offset) * unsigned_t(increment));
+				}
+				else {
+					return first + value_type(count + offset) * increment;
+				}
 			};
 		private:
-			value_type index, increment;
+			value_type first;
+			step_type increment;
+			difference_type count;
 		};
-	};
 
-	template<typename T>
-	constexpr intern::simple_range<intern::range_iterator<T>> range(T end) noexcept {
-		using stype = std::make_signed_t<T>;
-
-		if (end < T(0)) {
-			return intern::simple_range<intern::range_iterator<T>>{
-				intern::range_iterator<T>{end, stype(-1)},
-				intern::range_iterator<T>{T(0), stype(-1)}
-			};
+		// The number of steps of size inc needed to get from start to end, counting a final partial step.
+		template<typename T>
+		constexpr typename range_types<T>::difference_type range_steps(T start, T end, typename range_types<T>::step_type inc) noexcept {
+			using difference_type = typename range_types<T>::difference_type;
+
+			if constexpr (std::is_integral_v<T>) {
+				// Work with unsigned magnitudes, so no span of any T can overflow.
+				using unsigned_t = std::make_unsigned_t<difference_type>;
+				unsigned_t span = end < start ? unsigned_t(start) - unsigned_t(end) : unsigned_t(end) - unsigned_t(start);
+				unsigned_t step = inc < 0 ? unsigned_t(0) - unsigned_t(inc) : unsigned_t(inc);
+				return difference_type(span / step + (span % step != 0 ? 1 : 0));
+			}
+			else {
+				// Round up without <cmath>, the step count is small enough to be exact in T.
+				T steps = (end - start) / inc;
+				difference_type whole = difference_type(steps);
+				return T(whole) < steps ? whole + 1 : whole;
+			}
 		}
-		else {
-			return intern::simple_range<intern::range_iterator<T>>{
-				intern::range_iterator<T>{T(0), stype(1)},
-				intern::range_iterator<T>{end, stype(1)}
+
+		template<typename T>
+		constexpr simple_range<range_iterator<T>> make_range(T start, T end, typename range_types<T>::step_type inc) noexcept {
+			return simple_range<range_iterator<T>>{
+				range_iterator<T>{ start, inc, 0 },
+				range_iterator<T>{ start, inc, range_steps(start, end, inc) }
 			};
 		}
+	};
+
+	// Counts from zero up (or down) to end, excluding end.
+	template<typename T>
+	constexpr intern::simple_range<intern::range_iterator<T>> range(T end) noexcept {
+		using step_t = typename intern::range_types<T>::step_type;
+		return intern::make_range(T(0), end, end < T(0) ? step_t(-1) : step_t(1));
 	}
 
+	// Counts from start up (or down) to end, excluding end.
 	template<typename T>
 	constexpr intern::simple_range<intern::range_iterator<T>> range(T start, T end) noexcept {
-		using stype = std::make_signed_t<T>;
-
-		if (end < start) {
-			return intern::simple_range<intern::range_iterator<T>>{
-				intern::range_iterator<T>{start, stype(-1)},
-				intern::range_iterator<T>{end, stype(-1)}
-			};
-		}
-		else {
-			return intern::simple_range<intern::range_iterator<T>>{
-				intern::range_iterator<T>{start, stype(1)},
-				intern::range_iterator<T>{end, stype(1)}
-			};
-		}
+		using step_t = typename intern::range_types<T>::step_type;
+		return intern::make_range(start, end, end < start ? step_t(-1) : step_t(1));
 	}
 
+	// Counts from start towards end in steps of inc, excluding end. The last step may land short of end.
 	template<typename T, typename T1>
 	constexpr intern::simple_range<intern::range_iterator<T>> range(T start, T end, T1 inc) noexcept {
 		if (
 			(inc == T1(0)) || // Zero increment range makes no sense
-			((end < start) && (inc > 0)) // Increment must actually move in the correct direction.
+			((end < start) && (inc > T1(0))) || // Increment must actually move in the correct direction.
+			((start < end) && (inc < T1(0)))
 			) {
-			throw std::invalid_argument("Call to ez::range has invalid increment!\nMost likely this means the increment had an incorrect sign.\n");
+			// This function is noexcept, so an exception could only ever end in std::terminate anyway.
+			assert(false && "Call to ez::range has invalid increment! Most likely this means the increment had an incorrect sign.");
+			std::terminate();
 		}
 
-		return intern::simple_range<intern::range_iterator<T>>{
-			intern::range_iterator<T>{start, inc},
-			intern::range_iterator<T>{end, inc}
-		};
+		using step_t = typename intern::range_types<T>::step_type;
+		return intern::make_range(start, end, step_t(inc));
 	}
 };
\ No newline at end of file
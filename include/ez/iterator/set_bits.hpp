@@ -0,0 +1,182 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <bitset>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		// Index of the lowest set bit, the word must not be zero.
+		inline std::size_t count_trailing_zeros(std::uint64_t word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward64(&index, word);
+			return static_cast<std::size_t>(index);
+#else
+			return static_cast<std::size_t>(__builtin_ctzll(word));
+#endif
+		}
+
+		inline std::size_t popcount(std::uint64_t word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+			return static_cast<std::size_t>(__popcnt64(word));
+#else
+			return static_cast<std::size_t>(__builtin_popcountll(word));
+#endif
+		}
+
+		// Non owning view of an array of words
+		struct word_span {
+			const std::uint64_t* ptr;
+			std::size_t count;
+
+			const std::uint64_t* data() const noexcept {
+				return ptr;
+			}
+			std::size_t size() const noexcept {
+				return count;
+			}
+		};
+
+		/*
+		Iterates over the indices of the set bits in an array of words.
+		Each step clears the lowest set bit of the current word, so unset bits are never visited.
+		*/
+		class set_bit_iterator {
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::size_t;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::forward_iterator_tag;
+
+			set_bit_iterator() noexcept
+				: word(nullptr)
+				, last(nullptr)
+				, bits(0)
+				, base(0)
+			{}
+			set_bit_iterator(const std::uint64_t* _word, const std::uint64_t* _last) noexcept
+				: word(_word)
+				, last(_last)
+				, bits(0)
+				, base(0)
+			{
+				if (word != last) {
+					bits = *word;
+					skip_empty();
+				}
+			}
+
+			value_type operator*() const noexcept {
+				return base + count_trailing_zeros(bits);
+			}
+			value_type operator->() const noexcept {
+				return **this;
+			}
+
+			set_bit_iterator& operator++() noexcept {
+				bits &= bits - 1;
+				skip_empty();
+				return *this;
+			}
+			set_bit_iterator operator++(int) noexcept {
+				set_bit_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const set_bit_iterator& other) const noexcept {
+				return word == other.word && bits == other.bits;
+			}
+			bool operator!=(const set_bit_iterator& other) const noexcept {
+				return word != other.word || bits != other.bits;
+			}
+		private:
+			void skip_empty() noexcept {
+				while (bits == 0) {
+					if (++word == last) {
+						return;
+					}
+					bits = *word;
+					base += 64;
+				}
+			}
+
+			const std::uint64_t* word;
+			const std::uint64_t* last;
+			std::uint64_t bits;
+			std::size_t base;
+		};
+
+		template<typename Words>
+		class set_bit_range {
+		public:
+			using iterator = set_bit_iterator;
+
+			set_bit_range(const Words& _words)
+				: words(_words)
+			{}
+
+			iterator begin() const noexcept {
+				return iterator{ words.data(), words.data() + words.size() };
+			}
+			iterator end() const noexcept {
+				const std::uint64_t* last = words.data() + words.size();
+				return iterator{ last, last };
+			}
+
+			// The number of set bits, found with a popcount of every word.
+			std::size_t size() const noexcept {
+				std::size_t total = 0;
+				for (std::size_t i = 0; i < words.size(); ++i) {
+					total += popcount(words.data()[i]);
+				}
+				return total;
+			}
+			bool empty() const noexcept {
+				return !(begin() != end());
+			}
+		private:
+			Words words;
+		};
+	};
+
+	// Iterate over the indices of the set bits in a contiguous container of 64 bit words, bit i of word w has the index w * 64 + i.
+	template<typename Container>
+	intern::set_bit_range<intern::word_span> set_bits(const Container& words) noexcept {
+		static_assert(std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(words.data())>>, std::uint64_t>, "ez::set_bits requires a contiguous container of std::uint64_t!");
+		return intern::word_span{ words.data(), static_cast<std::size_t>(words.size()) };
+	}
+
+	inline intern::set_bit_range<intern::word_span> set_bits(const std::uint64_t* words, std::size_t count) noexcept {
+		return intern::word_span{ words, count };
+	}
+
+	// std::bitset does not expose its storage, so the bits are packed into words owned by the returned range.
+	// The packing happens a word at a time (or a set bit at a time with libstdc++), never a bit at a time. Word arrays skip the copy and stay the fast path.
+	template<std::size_t N>
+	intern::set_bit_range<std::array<std::uint64_t, (N + 63) / 64>> set_bits(const std::bitset<N>& bits) noexcept {
+		std::array<std::uint64_t, (N + 63) / 64> words{};
+#if defined(__GLIBCXX__)
+		// libstdc++ can find the set bits a word at a time.
+		for (std::size_t i = bits._Find_first(); i < N; i = bits._Find_next(i)) {
+			words[i / 64] |= std::uint64_t(1) << (i % 64);
+		}
+#else
+		const std::bitset<N> mask{ ~0ull };
+		std::bitset<N> rest = bits;
+		for (std::size_t w = 0; w < words.size(); ++w, rest >>= 64) {
+			words[w] = static_cast<std::uint64_t>((rest & mask).to_ullong());
+		}
+#endif
+		return words;
+	}
+};
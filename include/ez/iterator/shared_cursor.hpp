@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <cassert>
+#include <atomic>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	/*
+	Hands out consecutive batches of a random access range to any number of threads.
+	Each claim is a single atomic fetch add, so workers that finish early simply claim more work.
+	The cursor does not own the range, the source must outlive all the claimed batches.
+	*/
+	template<typename Iter>
+	class shared_cursor_t {
+	public:
+		static_assert(intern::is_random_iterator_v<Iter>, "ez::shared_cursor requires a random access iterator!");
+
+		using iterator = Iter;
+		using range_type = intern::simple_range<Iter>;
+		using size_type = std::size_t;
+
+		shared_cursor_t(const Iter& _first, size_type _count, size_type _batch) noexcept
+			: first(_first)
+			, count(_count)
+			, batch(_batch)
+			, next(0)
+		{
+			assert(batch > 0 && "ez::shared_cursor requires a batch size of at least one!");
+		}
+		shared_cursor_t(const shared_cursor_t&) = delete;
+		shared_cursor_t& operator=(const shared_cursor_t&) = delete;
+
+		// Claim the next batch, the returned range is empty once the source has been exhausted.
+		range_type claim() noexcept {
+			size_type start = next.fetch_add(batch, std::memory_order_relaxed);
+			if (start >= count) {
+				return range_type{ end(), end() };
+			}
+
+			size_type stop = (count - start) > batch ? start + batch : count;
+			return range_type{ first + start, first + stop };
+		}
+
+		// The index of an iterator from a claimed batch in the original range.
+		std::ptrdiff_t index_of(const Iter& iter) const noexcept {
+			return iter - first;
+		}
+
+		Iter begin() const noexcept {
+			return first;
+		}
+		Iter end() const noexcept {
+			return first + count;
+		}
+		size_type size() const noexcept {
+			return count;
+		}
+		size_type batch_size() const noexcept {
+			return batch;
+		}
+
+		// Start handing out batches from the beginning again, must not be called while other threads are claiming.
+		void reset() noexcept {
+			next.store(0, std::memory_order_relaxed);
+		}
+	private:
+		Iter first;
+		size_type count, batch;
+
+		// Keep the contended counter on its own cache line
+		alignas(64) std::atomic<size_type> next;
+	};
+
+	// Create a cursor for claiming batches of a random access range from multiple threads.
+	template<typename Container>
+	auto shared_cursor(Container&& container, std::size_t batch) {
+		using container_t = std::remove_reference_t<Container>;
+		using iterator_t = intern::range_iterator_t<container_t>;
+
+		static_assert(intern::is_random_iterator_v<iterator_t>, "ez::shared_cursor requires a random access iterator!");
+
+		return shared_cursor_t<iterator_t>{ container.begin(), intern::range_size(container), batch };
+	}
+};
@@ -0,0 +1,188 @@
+#pragma once
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	// Stride value signaling that the stride is only known at runtime.
+	static constexpr std::ptrdiff_t dynamic_stride = 0;
+
+	namespace intern {
+		template<std::ptrdiff_t Bytes>
+		class stride_storage {
+		public:
+			constexpr stride_storage(std::ptrdiff_t) noexcept {}
+
+			constexpr std::ptrdiff_t stride_bytes() const noexcept {
+				return Bytes;
+			}
+		};
+
+		template<>
+		class stride_storage<dynamic_stride> {
+		public:
+			constexpr stride_storage(std::ptrdiff_t _bytes) noexcept
+				: bytes(_bytes)
+			{}
+
+			constexpr std::ptrdiff_t stride_bytes() const noexcept {
+				return bytes;
+			}
+		private:
+			std::ptrdiff_t bytes;
+		};
+
+		/*
+		Random access iterator over objects of type T placed at a fixed byte distance from each other.
+		The position is kept as an index from the first element, so the end iterator never points outside of the storage.
+		A compile time stride lets the compiler turn loops over this iterator into plain strided loads.
+		*/
+		template<typename T, std::ptrdiff_t ByteStride = dynamic_stride>
+		class strided_iterator : private stride_storage<ByteStride> {
+		public:
+			using stride_t = stride_storage<ByteStride>;
+			using byte_t = std::conditional_t<std::is_const_v<T>, const unsigned char, unsigned char>;
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::remove_cv_t<T>;
+			using reference = T&;
+			using pointer = T*;
+			using iterator_category = std::random_access_iterator_tag;
+
+			constexpr strided_iterator() noexcept
+				: stride_t(ByteStride)
+				, base(nullptr)
+				, index(0)
+			{}
+			constexpr strided_iterator(T* _base, difference_type _index, difference_type _stride_bytes = ByteStride) noexcept
+				: stride_t(_stride_bytes)
+				, base(reinterpret_cast<byte_t*>(_base))
+				, index(_index)
+			{}
+
+			reference operator*() const noexcept {
+				return *address(index);
+			}
+			pointer operator->() const noexcept {
+				return address(index);
+			}
+			reference operator[](difference_type offset) const noexcept {
+				return *address(index + offset);
+			}
+
+			strided_iterator& operator++() noexcept {
+				++index;
+				return *this;
+			}
+			strided_iterator operator++(int) noexcept {
+				strided_iterator copy = *this;
+				++index;
+				return copy;
+			}
+			strided_iterator& operator--() noexcept {
+				--index;
+				return *this;
+			}
+			strided_iterator operator--(int) noexcept {
+				strided_iterator copy = *this;
+				--index;
+				return copy;
+			}
+
+			strided_iterator& operator+=(difference_type offset) noexcept {
+				index += offset;
+				return *this;
+			}
+			strided_iterator& operator-=(difference_type offset) noexcept {
+				index -= offset;
+				return *this;
+			}
+			strided_iterator operator+(difference_type offset) const noexcept {
+				strided_iterator copy = *this;
+				copy.index += offset;
+				return copy;
+			}
+			strided_iterator operator-(difference_type offset) const noexcept {
+				strided_iterator copy = *this;
+				copy.index -= offset;
+				return copy;
+			}
+			difference_type operator-(const strided_iterator& other) const noexcept {
+				return index - other.index;
+			}
+
+			bool operator==(const strided_iterator& other) const noexcept {
+				return index == other.index;
+			}
+			bool operator!=(const strided_iterator& other) const noexcept {
+				return index != other.index;
+			}
+			bool operator<(const strided_iterator& other) const noexcept {
+				return index < other.index;
+			}
+			bool operator<=(const strided_iterator& other) const noexcept {
+				return index <= other.index;
+			}
+			bool operator>(const strided_iterator& other) const noexcept {
+				return index > other.index;
+			}
+			bool operator>=(const strided_iterator& other) const noexcept {
+				return index >= other.index;
+			}
+		private:
+			pointer address(difference_type i) const noexcept {
+				return reinterpret_cast<pointer>(base + i * this->stride_bytes());
+			}
+
+			byte_t* base;
+			difference_type index;
+		};
+
+		template<typename T, std::ptrdiff_t ByteStride>
+		simple_range<strided_iterator<T, ByteStride>> make_strided_range(T* first, std::size_t count, std::ptrdiff_t stride_bytes) noexcept {
+			using iterator_t = strided_iterator<T, ByteStride>;
+
+			return simple_range<iterator_t>{
+				iterator_t{ first, 0, stride_bytes },
+				iterator_t{ first, static_cast<std::ptrdiff_t>(count), stride_bytes }
+			};
+		}
+	};
+
+	// View every Stride'th element of a contiguous container, with the stride fixed at compile time.
+	template<std::ptrdiff_t Stride, typename Container>
+	auto strided(Container&& container) noexcept {
+		using element_t = std::remove_reference_t<decltype(*container.data())>;
+		static_assert(Stride > 0, "ez::strided requires a positive stride!");
+
+		std::size_t count = (static_cast<std::size_t>(container.size()) + Stride - 1) / Stride;
+		return intern::make_strided_range<element_t, Stride * static_cast<std::ptrdiff_t>(sizeof(element_t))>(container.data(), count, Stride * sizeof(element_t));
+	}
+
+	// View every stride'th element of a contiguous container.
+	template<typename Container>
+	auto strided(Container&& container, std::ptrdiff_t stride) noexcept {
+		using element_t = std::remove_reference_t<decltype(*container.data())>;
+		assert(stride > 0 && "ez::strided requires a positive stride!");
+
+		std::size_t count = (static_cast<std::size_t>(container.size()) + stride - 1) / stride;
+		return intern::make_strided_range<element_t, dynamic_stride>(container.data(), count, stride * static_cast<std::ptrdiff_t>(sizeof(element_t)));
+	}
+
+	// View a single data member of every object in a contiguous container, for example ez::project(particles, &particle::x)
+	template<typename Container, typename Member, typename Object>
+	auto project(Container&& container, Member Object::* field) noexcept {
+		using element_t = std::remove_reference_t<decltype(*container.data())>;
+		using member_t = std::conditional_t<std::is_const_v<element_t>, const Member, Member>;
+		static_assert(std::is_same_v<std::remove_cv_t<element_t>, Object>, "ez::project requires a member of the container's value type!");
+
+		constexpr std::ptrdiff_t stride_bytes = sizeof(element_t);
+		std::size_t count = static_cast<std::size_t>(container.size());
+		member_t* first = count == 0 ? nullptr : &(container.data()->*field);
+
+		return intern::make_strided_range<member_t, stride_bytes>(first, count, stride_bytes);
+	}
+};
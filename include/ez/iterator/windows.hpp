@@ -0,0 +1,232 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include "intern/helpers.hpp"
+
+namespace ez {
+	namespace intern {
+		/*
+		Iterates over every run of N consecutive elements in a range.
+		Forward sources yield sub ranges of the source itself, so nothing gets copied.
+		Input sources can only be read once, so the elements are kept in a ring buffer instead.
+		*/
+		template<typename Iter, std::size_t N, bool = is_forward_iterator_v<Iter>>
+		class window_iterator {
+		public:
+			static_assert(N > 0, "ez::windows requires a window size of at least one!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = simple_range<Iter>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::forward_iterator_tag;
+
+			window_iterator() = default;
+			window_iterator(const Iter& _first, const Iter& _last) noexcept
+				: first(_first)
+				, back(_first)
+			{
+				// back points at the final element in the window, an empty range is signaled by back reaching the end.
+				if (back == _last) {
+					return;
+				}
+				for (size_type i = 1; i < N; ++i) {
+					if (++back == _last) {
+						return;
+					}
+				}
+			}
+			// Construct the end iterator
+			window_iterator(const Iter& _last) noexcept
+				: first(_last)
+				, back(_last)
+			{}
+
+			value_type operator*() const noexcept {
+				Iter next = back;
+				return value_type{ first, ++next };
+			}
+			value_type operator->() const noexcept {
+				return **this;
+			}
+
+			window_iterator& operator++() {
+				++first;
+				++back;
+				return *this;
+			}
+			window_iterator operator++(int) {
+				window_iterator copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const window_iterator& other) const noexcept {
+				return back == other.back;
+			}
+			bool operator!=(const window_iterator& other) const noexcept {
+				return back != other.back;
+			}
+		private:
+			Iter first, back;
+		};
+
+		template<typename Iter, std::size_t N>
+		class window_iterator<Iter, N, false> {
+		public:
+			static_assert(N > 0, "ez::windows requires a window size of at least one!");
+
+			using source_value_type = iterator_value_t<Iter>;
+			static_assert(std::is_default_constructible_v<source_value_type>, "ez::windows requires a default constructible value type for input iterators!");
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = simple_range<source_value_type*>;
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = std::input_iterator_tag;
+
+			window_iterator(const Iter& _first, const Iter& _last)
+				: iter(_first)
+				, last(_last)
+				, ring{}
+				, head(0)
+				, done(false)
+			{
+				for (size_type i = 0; i < N; ++i) {
+					if (iter == last) {
+						done = true;
+						return;
+					}
+					push();
+				}
+			}
+			// Construct the end iterator
+			window_iterator(const Iter& _last)
+				: iter(_last)
+				, last(_last)
+				, ring{}
+				, head(0)
+				, done(true)
+			{}
+
+			// The ring stores every element twice, so the window is always a contiguous block of the buffer.
+			value_type operator*() noexcept {
+				return value_type{ ring + head, ring + head + N };
+			}
+			value_type operator->() noexcept {
+				return **this;
+			}
+
+			window_iterator& operator++() {
+				if (iter == last) {
+					done = true;
+				}
+				else {
+					push();
+				}
+				return *this;
+			}
+			void operator++(int) {
+				++(*this);
+			}
+
+			bool operator==(const window_iterator& other) const noexcept {
+				return done == other.done;
+			}
+			bool operator!=(const window_iterator& other) const noexcept {
+				return done != other.done;
+			}
+		private:
+			void push() {
+				ring[head] = *iter;
+				ring[head + N] = ring[head];
+				++iter;
+				head = (head + 1 == N) ? 0 : head + 1;
+			}
+
+			Iter iter, last;
+			source_value_type ring[N * 2];
+			size_type head;
+			bool done;
+		};
+
+		template<typename Iter>
+		class adjacent_iterator {
+		public:
+			using window_t = window_iterator<Iter, 2>;
+			using window_value_t = typename window_t::value_type;
+			using element_reference = decltype(*std::declval<range_iterator_t<window_value_t>&>());
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			struct value_type {
+				element_reference first;
+				element_reference second;
+			};
+			using reference = value_type;
+			using pointer = value_type;
+			using iterator_category = typename window_t::iterator_category;
+
+			adjacent_iterator(const window_t& _window) noexcept
+				: window(_window)
+			{}
+
+			value_type operator*() {
+				auto iter = (*window).begin();
+				element_reference first = *iter;
+				++iter;
+				return value_type{ first, *iter };
+			}
+			value_type operator->() {
+				return **this;
+			}
+
+			adjacent_iterator& operator++() {
+				++window;
+				return *this;
+			}
+			adjacent_iterator operator++(int) {
+				adjacent_iterator copy = *this;
+				++window;
+				return copy;
+			}
+
+			bool operator==(const adjacent_iterator& other) const noexcept {
+				return window == other.window;
+			}
+			bool operator!=(const adjacent_iterator& other) const noexcept {
+				return window != other.window;
+			}
+		private:
+			window_t window;
+		};
+	};
+
+	// Iterate over every group of N consecutive elements in a container. Each window is itself a range of N elements.
+	template<std::size_t N, typename Container>
+	auto windows(Container&& container) {
+		using container_iterator_t = decltype(container.begin());
+		using window_t = intern::window_iterator<container_iterator_t, N>;
+
+		return intern::simple_range<window_t>{
+			window_t{ container.begin(), container.end() },
+			window_t{ container.end() }
+		};
+	}
+
+	// Iterate over every pair of neighboring elements in a container, the pairs have 'first' and 'second' members.
+	template<typename Container>
+	auto adjacent(Container&& container) {
+		using container_iterator_t = decltype(container.begin());
+		using window_t = intern::window_iterator<container_iterator_t, 2>;
+		using adjacent_t = intern::adjacent_iterator<container_iterator_t>;
+
+		return intern::simple_range<adjacent_t>{
+			adjacent_t{ window_t{ container.begin(), container.end() } },
+			adjacent_t{ window_t{ container.end() } }
+		};
+	}
+};
@@ -0,0 +1,81 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/any_range.hpp>
+#include <ez/iterator/merge.hpp>
+#include <vector>
+#include <array>
+#include <cassert>
+
+namespace {
+	// Stands in for a function on the other side of a module boundary
+	long long sum_all(ez::any_range<long long> values) {
+		std::array<long long, 16> batch;
+		long long total = 0;
+		for (std::size_t count = values.next_batch(batch); count != 0; count = values.next_batch(batch)) {
+			for (std::size_t i = 0; i < count; ++i) {
+				total += batch[i];
+			}
+		}
+		return total;
+	}
+};
+
+void test_any_range() {
+	fmt::print("Begin test_any_range()\n");
+
+	std::vector<long long> values;
+	for (long long i = 0; i < 100; ++i) {
+		values.push_back(i);
+	}
+
+	{ // Per element iteration
+		ez::any_range<long long> erased = values;
+		CHECK(erased.is_inline());
+
+		long long expected = 0;
+		for (long long value : erased) {
+			CHECK(value == expected);
+			++expected;
+		}
+		CHECK(expected == 100);
+
+		ez::any_range<long long> empty;
+		CHECK(!(empty.begin() != empty.end()));
+	}
+	fmt::print("Per element iteration test passed\n");
+
+	{ // Batched pulls over different range types
+		CHECK(sum_all(values) == 4950);
+		CHECK(sum_all(ez::range<long long>(100)) == 4950);
+		CHECK(sum_all(ez::adapt(values, [](long long& val) -> long long { return val * 2; })) == 9900);
+		CHECK(sum_all(ez::merge(values, values)) == 9900);
+
+		std::vector<long long> batch(64);
+		ez::any_range<long long> erased = ez::range<long long>(100);
+		CHECK(erased.next_batch(batch) == 64);
+		CHECK(batch[63] == 63);
+		CHECK(erased.next_batch(batch) == 36);
+		CHECK(batch[35] == 99);
+		CHECK(erased.next_batch(batch) == 0);
+	}
+	fmt::print("Batched pull test passed\n");
+
+	{ // Moving keeps the position, large iterators go on the heap
+		ez::any_range<long long> erased = values;
+		long long first;
+		CHECK(erased.next_batch(&first, 1) == 1);
+
+		ez::any_range<long long> moved = std::move(erased);
+		CHECK(erased.next_batch(&first, 1) == 0);
+		CHECK(moved.next_batch(&first, 1) == 1);
+		CHECK(first == 1);
+
+		ez::any_range<long long, 16> small = ez::merge(values, values, values);
+		CHECK(!small.is_inline());
+		ez::any_range<long long, 16> small_moved = std::move(small);
+		CHECK(sum_all(std::move(small_moved)) == 4950 * 3);
+	}
+	fmt::print("Move test passed\n");
+
+	fmt::print("End test_any_range()\n");
+}
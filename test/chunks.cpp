@@ -0,0 +1,65 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/collect.hpp>
+#include <vector>
+#include <list>
+#include <cassert>
+
+void test_chunks() {
+	fmt::print("Begin test_chunks()\n");
+
+	std::vector<int> values;
+	for (int i = 0; i < 10; ++i) {
+		values.push_back(i);
+	}
+
+	{ // Random access chunks
+		auto batches = ez::chunks(values, 4);
+		CHECK(batches.size() == 3);
+		CHECK(batches[2].size() == 2);
+		CHECK(&batches[1][0] == &values[4]);
+
+		int expected = 0;
+		for (auto batch : batches) {
+			for (auto&& [value, index] : ez::enumerate(batch)) {
+				CHECK(value == expected);
+				++expected;
+			}
+		}
+		CHECK(expected == 10);
+
+		CHECK(ez::chunks(values, 5).size() == 2);
+		CHECK(ez::chunks(values, 20).size() == 1);
+
+		std::vector<int> empty;
+		CHECK(ez::chunks(empty, 3).size() == 0);
+
+		// Chunks of a range keep working with the rest of the library
+		auto steps = ez::chunks(ez::range(0, 100), 32);
+		CHECK(steps.size() == 4);
+		CHECK(ez::collect<std::vector<int>>(steps[3]).size() == 4);
+	}
+	fmt::print("Random access chunk test passed\n");
+
+	{ // Forward chunks
+		std::list<int> listed(values.begin(), values.end());
+
+		int count = 0, expected = 0;
+		for (auto batch : ez::chunks(listed, 3)) {
+			std::ptrdiff_t size = 0;
+			for (auto&& [value, index] : ez::enumerate(batch)) {
+				CHECK(value == expected);
+				CHECK(index == size);
+				++expected;
+				++size;
+			}
+			CHECK(size == (count < 3 ? 3 : 1));
+			++count;
+		}
+		CHECK(count == 4);
+		CHECK(expected == 10);
+	}
+	fmt::print("Forward chunk test passed\n");
+
+	fmt::print("End test_chunks()\n");
+}
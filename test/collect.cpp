@@ -0,0 +1,104 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/collect.hpp>
+#include <vector>
+#include <list>
+#include <cassert>
+
+struct doubler {
+	int operator()(int val) const {
+		return val * 2;
+	}
+};
+
+// Records how often collect reserves up front
+struct reserve_counter : std::vector<int> {
+	void reserve(std::size_t count) {
+		++reserves;
+		std::vector<int>::reserve(count);
+	}
+
+	int reserves = 0;
+};
+
+void test_collect() {
+	fmt::print("Begin test_collect()\n");
+
+	std::vector<int> values;
+	for (int i = 0; i < 100; ++i) {
+		values.push_back(i);
+	}
+
+	{ // Sized ranges should allocate exactly once.
+		std::vector<int> result = ez::collect<std::vector<int>>(ez::range(100));
+		CHECK(result.size() == 100);
+		CHECK(result.capacity() == 100);
+		CHECK(result == values);
+	}
+	fmt::print("Collect of sized range test passed\n");
+
+	{ // Functor adaptors keep the size of the source range, lambda adaptors fall back to growing the container
+		std::vector<int> result = ez::collect<std::vector<int>>(ez::range(0, 100, 2));
+		CHECK(result.size() == 50);
+		CHECK(result.capacity() == 50);
+
+		result = ez::collect<std::vector<int>>(ez::adapt<doubler>(values));
+		CHECK(result.size() == 100);
+		CHECK(result.capacity() == 100);
+		CHECK(result.back() == 198);
+
+		auto doubled = ez::adapt(values, [](int& val) -> int { return val * 2; });
+
+		std::list<int> listed = ez::collect<std::list<int>>(values);
+		CHECK(listed.size() == values.size());
+		CHECK(listed.back() == 99);
+
+		int i = 0;
+		for (int val : ez::collect<std::vector<int>>(doubled)) {
+			CHECK(val == i * 2);
+			++i;
+		}
+		CHECK(i == 100);
+
+		reserve_counter counted = ez::collect<reserve_counter>(ez::adapt<doubler>(values));
+		CHECK(counted.reserves == 1);
+		counted = ez::collect<reserve_counter>(doubled);
+		CHECK(counted.reserves == 0);
+		CHECK(counted.size() == 100);
+	}
+	fmt::print("Collect of adapted range test passed\n");
+
+	{ // Arena storage
+		ez::arena storage;
+
+		auto sized = ez::collect_into(ez::range(100), storage);
+		CHECK(sized.size() == 100);
+		CHECK(storage.num_blocks() == 1);
+		for (auto&& [value, index] : ez::enumerate(sized)) {
+			CHECK(value == index);
+		}
+
+		std::list<int> listed(values.begin(), values.end());
+		auto from_list = ez::collect_into(listed, storage);
+		CHECK(from_list.size() == 100);
+		for (auto&& [value, index] : ez::enumerate(from_list)) {
+			CHECK(value == index);
+		}
+
+		storage.release();
+		CHECK(storage.num_blocks() == 0);
+
+		// Lambda adaptors don't know their size, so the buffer grows from 16 to 128 elements.
+		// The blocks are small enough that every buffer needs a block of its own.
+		ez::arena small(16 * sizeof(int));
+		auto unsized = ez::collect_into(ez::adapt(values, [](int& val) -> int { return val * 2; }), small);
+		CHECK(unsized.size() == 100);
+		CHECK(small.num_blocks() == 4);
+		for (auto&& [value, index] : ez::enumerate(unsized)) {
+			CHECK(value == int(index) * 2);
+		}
+	}
+	fmt::print("Collect into arena test passed\n");
+
+	fmt::print("End test_collect()\n");
+}
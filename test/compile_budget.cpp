@@ -0,0 +1,133 @@
+// Instantiation stress test, compiled by the compile_budget target to keep an eye on the cost of the headers.
+// Every feature is instantiated once per distinct functor type, similar to a translation unit with many different pipelines.
+#include <ez/iterator/all.hpp>
+#include <vector>
+#include <list>
+#include <bitset>
+#include <cstdint>
+#include <utility>
+
+namespace {
+	template<int I>
+	struct add_n {
+		int operator()(int value) const {
+			return value + I;
+		}
+	};
+
+	template<int I>
+	struct less_n {
+		bool operator()(int lh, int rh) const {
+			return lh + I < rh + I;
+		}
+	};
+
+	template<int I>
+	struct record {
+		int id;
+		float value[I % 4 + 1];
+	};
+
+	template<int I>
+	long long pipeline(std::vector<int>& values, std::list<int>& listed) {
+		long long total = 0;
+
+		for (int value : ez::adapt<add_n<I>>(values)) {
+			total += value;
+		}
+		for (auto&& [value, index] : ez::enumerate(ez::adapt<add_n<I>>(values))) {
+			total += value * index;
+		}
+		for (auto&& [value, index] : ez::renumerate(values)) {
+			total += value - index;
+		}
+		for (auto value : ez::range<long long>(I, I * 4, 3)) {
+			total += value;
+		}
+		for (double value : ez::range(double(I), 100.0)) {
+			total += static_cast<long long>(value);
+		}
+		for (auto chunk : ez::chunks(ez::adapt<add_n<I>>(listed), I + 1)) {
+			for (auto&& [value, index] : ez::enumerate(chunk)) {
+				total += value + index;
+			}
+		}
+		for (auto window : ez::windows<I % 4 + 1>(values)) {
+			total += window[0];
+		}
+
+		std::vector<record<I>> records(values.size());
+		for (int& id : ez::project(records, &record<I>::id)) {
+			total += id;
+		}
+		for (int value : ez::strided<I % 3 + 1>(values)) {
+			total += value;
+		}
+		return total;
+	}
+
+	template<int I>
+	long long heavy_pipeline(std::vector<int>& values, std::vector<std::vector<int>>& shards) {
+		long long total = 0;
+
+		for (int value : ez::collect<std::vector<int>>(ez::adapt<add_n<I>>(values))) {
+			total += value;
+		}
+		ez::arena storage;
+		for (int value : ez::collect_into(ez::range(I, I * 2 + 8, 3), storage)) {
+			total += value;
+		}
+
+		for (int value : ez::merge_by(less_n<I>{}, shards[0], shards[1], shards[2])) {
+			total += value;
+		}
+		for (int value : ez::merge_all(shards, less_n<I>{})) {
+			total += value;
+		}
+
+		for (auto&& index : ez::ndrange(I + 1, 3, 2)) {
+			total += index[0] * index[2];
+		}
+		for (auto&& index : ez::tiled_ndrange<2>({ I + 1, 5 }, { 2, 2 })) {
+			total += index[1];
+		}
+		for (auto&& [lh, rh] : ez::product(ez::range(I + 1), values)) {
+			total += lh * rh;
+		}
+
+		ez::any_range<int> erased = ez::adapt<add_n<I>>(values);
+		int batch[16];
+		for (std::size_t count = erased.next_batch(batch, 16); count != 0; count = erased.next_batch(batch, 16)) {
+			total += batch[count - 1];
+		}
+
+		std::bitset<I * 8 + 1> flags;
+		flags.set(I);
+		for (std::size_t index : ez::set_bits(flags)) {
+			total += static_cast<long long>(index);
+		}
+
+		auto cursor = ez::shared_cursor(ez::adapt<add_n<I>>(values), I + 1);
+		for (auto claimed = cursor.claim(); !claimed.empty(); claimed = cursor.claim()) {
+			total += cursor.index_of(claimed.begin());
+		}
+		return total;
+	}
+
+	template<int... Is>
+	long long run_all(std::vector<int>& values, std::list<int>& listed, std::integer_sequence<int, Is...>) {
+		return (pipeline<Is>(values, listed) + ...);
+	}
+
+	template<int... Is>
+	long long run_all_heavy(std::vector<int>& values, std::vector<std::vector<int>>& shards, std::integer_sequence<int, Is...>) {
+		return (heavy_pipeline<Is>(values, shards) + ...);
+	}
+};
+
+long long compile_budget_entry() {
+	std::vector<int> values(64, 1);
+	std::list<int> listed(values.begin(), values.end());
+	std::vector<std::vector<int>> shards(3, values);
+	return run_all(values, listed, std::make_integer_sequence<int, 64>{}) + run_all_heavy(values, shards, std::make_integer_sequence<int, 64>{});
+}
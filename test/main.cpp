@@ -1,6 +1,15 @@
 void test_enumerations();
 void test_adapt();
 void test_ranges();
+void test_collect();
+void test_windows();
+void test_ndrange();
+void test_shared_cursor();
+void test_set_bits();
+void test_merge();
+void test_any_range();
+void test_strided();
+void test_chunks();
 
 int main(int arg, char* argv[]) {
 	test_enumerations();
@@ -9,5 +18,23 @@ int main(int arg, char* argv[]) {
 
 	test_ranges();
 
+	test_collect();
+
+	test_windows();
+
+	test_ndrange();
+
+	test_shared_cursor();
+
+	test_set_bits();
+
+	test_merge();
+
+	test_any_range();
+
+	test_strided();
+
+	test_chunks();
+
 	return 0;
 }
\ No newline at end of file
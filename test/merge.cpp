@@ -0,0 +1,105 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/merge.hpp>
+#include <ez/iterator/collect.hpp>
+#include <vector>
+#include <list>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <cassert>
+
+void test_merge() {
+	fmt::print("Begin test_merge()\n");
+
+	std::vector<std::vector<int>> shards(7);
+	std::vector<int> expected;
+	for (int i = 0; i < 200; ++i) {
+		int value = (i * 37) % 101;
+		shards[(i * 13) % shards.size()].push_back(value);
+		expected.push_back(value);
+	}
+	for (std::vector<int>& shard : shards) {
+		std::sort(shard.begin(), shard.end());
+	}
+	std::sort(expected.begin(), expected.end());
+
+	{ // Two way merge
+		std::vector<int> result = ez::collect<std::vector<int>>(ez::merge(shards[0], shards[1]));
+
+		std::vector<int> reference;
+		std::merge(shards[0].begin(), shards[0].end(), shards[1].begin(), shards[1].end(), std::back_inserter(reference));
+		CHECK(result == reference);
+
+		std::vector<int> empty;
+		CHECK(ez::collect<std::vector<int>>(ez::merge(empty, shards[2])) == shards[2]);
+		CHECK(ez::collect<std::vector<int>>(ez::merge(shards[2], empty)) == shards[2]);
+	}
+	fmt::print("Two way merge test passed\n");
+
+	{ // Fixed number of ranges
+		std::vector<int> result = ez::collect<std::vector<int>>(ez::merge(shards[0], shards[1], shards[2], shards[3], shards[4], shards[5], shards[6]));
+		CHECK(result == expected);
+
+		std::vector<int> single = ez::collect<std::vector<int>>(ez::merge(shards[3]));
+		CHECK(single == shards[3]);
+	}
+	fmt::print("Fixed merge test passed\n");
+
+	{ // Runtime number of ranges, with a custom comparison
+		std::vector<std::list<int>> descending;
+		for (std::vector<int>& shard : shards) {
+			descending.emplace_back(shard.rbegin(), shard.rend());
+		}
+
+		std::vector<int> result = ez::collect<std::vector<int>>(ez::merge_all(descending, std::greater<>{}));
+		CHECK(std::equal(result.begin(), result.end(), expected.rbegin(), expected.rend()));
+
+		std::vector<std::list<int>> none;
+		auto empty = ez::merge_all(none);
+		CHECK(!(empty.begin() != empty.end()));
+	}
+	fmt::print("Runtime merge test passed\n");
+
+	{ // Equal keys keep the order of their sources, in the two way and k-way merges alike
+		using entry = std::pair<int, int>;
+		auto by_key = [](const entry& lh, const entry& rh) {
+			return lh.first < rh.first;
+		};
+
+		std::vector<entry> a{ { 1, 0 }, { 1, 0 }, { 2, 0 } };
+		std::vector<entry> b{ { 1, 1 }, { 2, 1 } };
+		std::vector<entry> c{ { 1, 2 }, { 2, 2 } };
+		std::vector<entry> d{ { 0, 3 }, { 1, 3 } };
+
+		std::vector<int> sources;
+		std::vector<int> two_way{ 0, 0, 1, 0, 1 }, three_way{ 0, 0, 1, 2, 0, 1, 2 }, four_way{ 3, 3, 2, 1, 0, 0, 2, 1, 0 }, runtime{ 2, 0, 0, 1, 2, 0, 1 };
+		for (const entry& e : ez::merge_by(by_key, a, b)) {
+			sources.push_back(e.second);
+		}
+		CHECK(sources == two_way);
+
+		sources.clear();
+		for (const entry& e : ez::merge_by(by_key, a, b, c)) {
+			sources.push_back(e.second);
+		}
+		CHECK(sources == three_way);
+
+		sources.clear();
+		for (const entry& e : ez::merge_by(by_key, d, c, b, a)) {
+			sources.push_back(e.second);
+		}
+		CHECK(sources == four_way);
+
+		std::vector<std::vector<entry>> all{ c, a, b };
+		sources.clear();
+		for (const entry& e : ez::merge_all(all, by_key)) {
+			sources.push_back(e.second);
+		}
+		CHECK(sources == runtime);
+	}
+	fmt::print("Stable merge test passed\n");
+
+	fmt::print("End test_merge()\n");
+}
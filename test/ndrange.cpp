@@ -0,0 +1,79 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/ndrange.hpp>
+#include <vector>
+#include <array>
+#include <cassert>
+
+void test_ndrange() {
+	fmt::print("Begin test_ndrange()\n");
+
+	{ // Row major order
+		auto indices = ez::ndrange(3, 4, 5);
+		CHECK(indices.size() == 60);
+
+		std::ptrdiff_t flat = 0;
+		for (auto&& [z, y, x] : indices) {
+			CHECK(z * 20 + y * 5 + x == flat);
+			++flat;
+		}
+		CHECK(flat == 60);
+
+		// Random access jumps should agree with the incremental carries
+		auto iter = indices.begin();
+		for (std::ptrdiff_t i = 0; i < 60; ++i, ++iter) {
+			CHECK(*iter == indices[i]);
+			CHECK((indices.begin() + i) - indices.begin() == i);
+		}
+
+		auto back = indices.end();
+		--back;
+		CHECK((*back == std::array<std::ptrdiff_t, 3>{ 2, 3, 4 }));
+
+		CHECK(ez::ndrange(3, 0, 5).size() == 0);
+	}
+	fmt::print("Row major ndrange test passed\n");
+
+	{ // Tiled order should visit every index exactly once
+		std::vector<int> visited(7 * 5, 0);
+		std::ptrdiff_t count = 0;
+		for (auto&& [y, x] : ez::tiled_ndrange<2>({ 7, 5 }, { 2, 3 })) {
+			CHECK(y >= 0 && y < 7);
+			CHECK(x >= 0 && x < 5);
+			visited[y * 5 + x] += 1;
+
+			if (count == 3) {
+				// The first tile is 2x3, so the fourth index should be on the second row of the tile
+				CHECK(y == 1 && x == 0);
+			}
+			++count;
+		}
+		CHECK(count == 35);
+		for (int val : visited) {
+			CHECK(val == 1);
+		}
+	}
+	fmt::print("Tiled ndrange test passed\n");
+
+	{ // Cartesian product
+		std::vector<float> rows{ 0.f, 1.f, 2.f };
+
+		auto grid = ez::product(rows, ez::range(0, 8, 2));
+		CHECK(grid.size() == 12);
+
+		std::ptrdiff_t flat = 0;
+		for (auto&& [row, column] : grid) {
+			CHECK(&row == &rows[flat / 4]);
+			CHECK(column == (flat % 4) * 2);
+			++flat;
+		}
+		CHECK(flat == 12);
+
+		auto&& [row, column] = grid[7];
+		CHECK(row == 1.f);
+		CHECK(column == 6);
+	}
+	fmt::print("Product test passed\n");
+
+	fmt::print("End test_ndrange()\n");
+}
@@ -1,6 +1,7 @@
 #include "helpers.hpp"
 #include <ez/iterator.hpp>
 #include <vector>
+#include <cstdint>
 #include <array>
 #include <cassert>
 
@@ -34,6 +35,118 @@ void test_ranges() {
 	CHECK(t == 100);
 	fmt::print("Triple argument range test passed\n");
 
+	{ // Increments that do not divide the span still stop at the end, and the size counts the final partial step
+		t = 0;
+		for (int i : ez::range(0, 10, 3)) {
+			CHECK(i == t * 3);
+			++t;
+		}
+		CHECK(t == 4);
+		CHECK(ez::range(0, 10, 3).size() == 4);
+		CHECK(ez::range(0, 10, 2).size() == 5);
+
+		t = 0;
+		for (auto&& [value, index] : ez::enumerate(ez::range(0, 10, 3))) {
+			CHECK(value == int(index) * 3);
+			++t;
+		}
+		CHECK(t == 4);
+
+		t = 0;
+		for (int i : ez::range(10, -1, -4)) {
+			CHECK(i == 10 - t * 4);
+			++t;
+		}
+		CHECK(t == 3);
+		CHECK(ez::range(10, -1, -4).size() == 3);
+	}
+	fmt::print("Non dividing increment range test passed\n");
+
+	{ // Reversed unsigned ranges
+		unsigned expected = 10;
+		for (unsigned i : ez::range(10u, 0u)) {
+			CHECK(i == expected);
+			--expected;
+		}
+		CHECK(expected == 0);
+		CHECK(ez::range(10u, 0u).size() == 10);
+
+		t = 0;
+		for (unsigned i : ez::range(10u, 0u, -3)) {
+			CHECK(i == 10u - unsigned(t) * 3u);
+			++t;
+		}
+		CHECK(t == 4);
+		CHECK(ez::range(10u, 0u, -3).size() == 4);
+	}
+	fmt::print("Reversed unsigned range test passed\n");
+
+	{ // Narrow and wide unsigned types, with spans past what their signed counterparts can hold
+		auto shorts = ez::range<std::uint16_t>(0, 40000);
+		CHECK(shorts.size() == 40000);
+		std::size_t count = 0;
+		for (auto&& [value, index] : ez::enumerate(shorts)) {
+			CHECK(value == index);
+			++count;
+		}
+		CHECK(count == 40000);
+
+		count = 0;
+		for (std::uint8_t value : ez::range<std::uint8_t>(0, 200, 10)) {
+			CHECK(value == count * 10);
+			++count;
+		}
+		CHECK(count == 20);
+		CHECK(ez::range<std::uint8_t>(0, 200, 10).size() == 20);
+
+		// The final step would go past 255, the range still stops after it.
+		count = 0;
+		for (std::uint8_t value : ez::range<std::uint8_t>(0, 250, 30)) {
+			CHECK(value == count * 30);
+			++count;
+		}
+		CHECK(count == 9);
+		CHECK(ez::range<std::uint8_t>(0, 250, 30).size() == 9);
+
+		auto ints = ez::range<std::uint32_t>(0u, 3000000000u);
+		CHECK(ints.size() == 3000000000u);
+		CHECK(ints.begin()[2999999999] == 2999999999u);
+
+		count = 0;
+		for (auto&& [value, index] : ez::enumerate(ez::range<std::uint32_t>(0u, 3000000000u, 1000000))) {
+			CHECK(value == index * 1000000);
+			++count;
+		}
+		CHECK(count == 3000);
+		CHECK(ez::range<std::uint32_t>(3000000000u, 0u, -1000000).size() == 3000);
+	}
+	fmt::print("Unsigned span range test passed\n");
+
+	{ // Floating point ranges with spans that are not a whole number of steps
+		auto halves = ez::range(0.5, 10.0);
+		CHECK(halves.size() == 10);
+		int count = 0;
+		for (double value : halves) {
+			CHECK(approxEq(float(value), 0.5f + float(count)));
+			++count;
+		}
+		CHECK(count == 10);
+
+		auto thirds = ez::range(0.0, 1.0, 0.3);
+		CHECK(thirds.size() == 4);
+		count = 0;
+		for (double value : thirds) {
+			CHECK(approxEq(float(value), 0.3f * float(count)));
+			++count;
+		}
+		CHECK(count == 4);
+
+		auto down = ez::range(1.0f, 0.0f, -0.25f);
+		CHECK(down.size() == 4);
+		CHECK(down.begin()[3] == 0.25f);
+	}
+	fmt::print("Floating point range test passed\n");
+
 
 
 	fmt::print("End test_ranges() tests\n");
@@ -0,0 +1,67 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/set_bits.hpp>
+#include <ez/iterator/collect.hpp>
+#include <vector>
+#include <bitset>
+#include <cstdint>
+#include <cassert>
+
+void test_set_bits() {
+	fmt::print("Begin test_set_bits()\n");
+
+	std::vector<std::uint64_t> words(4, 0);
+	std::vector<std::size_t> expected{ 0, 5, 63, 64, 130, 191, 255 };
+	for (std::size_t index : expected) {
+		words[index / 64] |= std::uint64_t(1) << (index % 64);
+	}
+
+	{ // Word arrays
+		auto bits = ez::set_bits(words);
+		CHECK(bits.size() == expected.size());
+
+		std::size_t count = 0;
+		for (std::size_t index : bits) {
+			CHECK(index == expected[count]);
+			++count;
+		}
+		CHECK(count == expected.size());
+
+		std::vector<std::uint64_t> empty(3, 0);
+		CHECK(ez::set_bits(empty).empty());
+		CHECK(ez::set_bits(empty).size() == 0);
+	}
+	fmt::print("Word array test passed\n");
+
+	{ // std::bitset
+		std::bitset<200> flags;
+		flags.set(3);
+		flags.set(70);
+		flags.set(199);
+
+		auto bits = ez::set_bits(flags);
+		CHECK(bits.size() == 3);
+
+		std::vector<std::size_t> found = ez::collect<std::vector<std::size_t>>(bits);
+		CHECK((found == std::vector<std::size_t>{ 3, 70, 199 }));
+	}
+	fmt::print("Bitset test passed\n");
+
+	{ // Sparse gather
+		std::vector<float> column(256);
+		for (std::size_t i = 0; i < column.size(); ++i) {
+			column[i] = float(i) * 0.5f;
+		}
+
+		auto bits = ez::set_bits(words);
+		std::size_t count = 0;
+		for (float& value : ez::adapt(bits, [&column](std::size_t index) -> float& { return column[index]; })) {
+			CHECK(&value == &column[expected[count]]);
+			++count;
+		}
+		CHECK(count == expected.size());
+	}
+	fmt::print("Sparse gather test passed\n");
+
+	fmt::print("End test_set_bits()\n");
+}
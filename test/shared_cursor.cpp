@@ -0,0 +1,73 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <ez/iterator/shared_cursor.hpp>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cassert>
+
+void test_shared_cursor() {
+	fmt::print("Begin test_shared_cursor()\n");
+
+	{ // Single threaded claims
+		std::vector<int> values(10, 0);
+		auto cursor = ez::shared_cursor(values, 4);
+
+		auto batch = cursor.claim();
+		CHECK(batch.size() == 4);
+		CHECK(cursor.index_of(batch.begin()) == 0);
+
+		batch = cursor.claim();
+		CHECK(batch.size() == 4);
+		CHECK(cursor.index_of(batch.begin()) == 4);
+
+		batch = cursor.claim();
+		CHECK(batch.size() == 2);
+		CHECK(cursor.index_of(batch.begin()) == 8);
+
+		CHECK(cursor.claim().empty());
+		CHECK(cursor.claim().empty());
+
+		cursor.reset();
+		CHECK(cursor.claim().size() == 4);
+	}
+	fmt::print("Single threaded claim test passed\n");
+
+	{ // Many threads, every element should be claimed exactly once
+		std::vector<std::atomic<int>> visits(10007);
+		for (auto& count : visits) {
+			count.store(0);
+		}
+
+		auto cursor = ez::shared_cursor(ez::range<std::ptrdiff_t>(0, 10007), 64);
+
+		// CHECK returns from the enclosing function, so the workers only record a mismatch.
+		std::atomic<bool> mismatch{ false };
+
+		std::vector<std::thread> workers;
+		for (int i = 0; i < 4; ++i) {
+			workers.emplace_back([&]() {
+				for (auto batch = cursor.claim(); !batch.empty(); batch = cursor.claim()) {
+					std::ptrdiff_t offset = cursor.index_of(batch.begin());
+					for (auto&& [value, index] : ez::enumerate(batch)) {
+						if (value != offset + std::ptrdiff_t(index)) {
+							mismatch.store(true, std::memory_order_relaxed);
+						}
+						visits[value].fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			});
+		}
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+		CHECK(!mismatch.load());
+
+		for (auto& count : visits) {
+			CHECK(count.load() == 1);
+		}
+	}
+	fmt::print("Multi threaded claim test passed\n");
+
+	fmt::print("End test_shared_cursor()\n");
+}
@@ -0,0 +1,88 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <vector>
+#include <cassert>
+
+namespace {
+	struct record {
+		int id;
+		float x, y, z;
+	};
+};
+
+void test_strided() {
+	fmt::print("Begin test_strided()\n");
+
+	std::vector<int> values;
+	for (int i = 0; i < 10; ++i) {
+		values.push_back(i);
+	}
+
+	{ // Runtime and compile time strides
+		auto every_third = ez::strided(values, 3);
+		CHECK(every_third.size() == 4);
+		CHECK(every_third[3] == 9);
+
+		int expected = 0;
+		for (int& value : every_third) {
+			CHECK(&value == &values[expected]);
+			expected += 3;
+		}
+		CHECK(expected == 12);
+
+		auto every_other = ez::strided<2>(values);
+		CHECK(every_other.size() == 5);
+		CHECK(every_other[4] == 8);
+		CHECK(*(every_other.end() - 1) == 8);
+
+		const std::vector<int>& constant = values;
+		auto const_view = ez::strided(constant, 5);
+		static_assert(std::is_same_v<decltype(*const_view.begin()), const int&>, "ez::strided should keep the constness of the container!");
+		CHECK(const_view.size() == 2);
+	}
+	fmt::print("Strided view test passed\n");
+
+	{ // Projecting members of records
+		std::vector<record> records;
+		for (int i = 0; i < 8; ++i) {
+			records.push_back(record{ i, float(i), float(i) * 2.f, float(i) * 3.f });
+		}
+
+		auto ys = ez::project(records, &record::y);
+		CHECK(ys.size() == 8);
+
+		float sum = 0.f;
+		for (float& y : ys) {
+			sum += y;
+		}
+		CHECK(approxEq(sum, 56.f));
+
+		for (auto&& [y, index] : ez::enumerate(ys)) {
+			CHECK(&y == &records[index].y);
+			y = 0.f;
+		}
+		CHECK(records[5].y == 0.f);
+		CHECK(records[5].z == 15.f);
+
+		std::vector<record> none;
+		CHECK(ez::project(none, &record::x).size() == 0);
+	}
+	fmt::print("Projection test passed\n");
+
+	{ // Postfix operators on offset_adaptor advance the iterator itself
+		// The library's own strided_iterator is portably constructible from a pointer, unlike std::vector<int>::iterator.
+		using adaptor_t = ez::offset_adaptor<ez::intern::strided_iterator<int, sizeof(int)>, 2>;
+		adaptor_t iter(values.data(), 0);
+
+		adaptor_t old = iter++;
+		CHECK(*old == 0);
+		CHECK(*iter == 2);
+
+		old = iter--;
+		CHECK(*old == 2);
+		CHECK(*iter == 0);
+	}
+	fmt::print("Offset adaptor test passed\n");
+
+	fmt::print("End test_strided()\n");
+}
@@ -0,0 +1,116 @@
+#include "helpers.hpp"
+#include <ez/iterator.hpp>
+#include <vector>
+#include <list>
+#include <string>
+#include <sstream>
+#include <iterator>
+#include <cassert>
+
+template<typename Iter>
+struct stream_range {
+	Iter first, last;
+
+	Iter begin() const {
+		return first;
+	}
+	Iter end() const {
+		return last;
+	}
+};
+
+void test_windows() {
+	fmt::print("Begin test_windows()\n");
+
+	std::vector<int> values;
+	for (int i = 0; i < 10; ++i) {
+		values.push_back(i * i);
+	}
+
+	{ // Random access windows are views into the source
+		int count = 0;
+		for (auto window : ez::windows<3>(values)) {
+			CHECK(window.size() == 3);
+			CHECK(&window[0] == &values[count]);
+			CHECK(window[2] == values[count + 2]);
+			++count;
+		}
+		CHECK(count == 8);
+
+		count = 0;
+		for ([[maybe_unused]] auto window : ez::windows<11>(values)) {
+			++count;
+		}
+		CHECK(count == 0);
+	}
+	fmt::print("Random access window test passed\n");
+
+	{ // Forward windows
+		std::list<int> listed(values.begin(), values.end());
+		int count = 0;
+		for (auto window : ez::windows<4>(listed)) {
+			int sum = 0;
+			for (int val : window) {
+				sum += val;
+			}
+			CHECK(sum == values[count] + values[count + 1] + values[count + 2] + values[count + 3]);
+			++count;
+		}
+		CHECK(count == 7);
+	}
+	fmt::print("Forward window test passed\n");
+
+	{ // Input windows use a ring buffer
+		std::istringstream stream("0 1 4 9 16 25 36 49 64 81");
+		stream_range<std::istream_iterator<int>> source{ std::istream_iterator<int>(stream), std::istream_iterator<int>() };
+
+		int count = 0;
+		for (auto window : ez::windows<3>(source)) {
+			CHECK(window.size() == 3);
+			CHECK(window[0] == values[count]);
+			CHECK(window[1] == values[count + 1]);
+			CHECK(window[2] == values[count + 2]);
+			++count;
+		}
+		CHECK(count == 8);
+	}
+	fmt::print("Input window test passed\n");
+
+	{ // Input iterators over strings may throw when moved, the windows still have to work
+		std::istringstream stream("the quick brown fox jumps");
+		stream_range<std::istream_iterator<std::string>> source{ std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>() };
+
+		std::vector<std::string> words{ "the", "quick", "brown", "fox", "jumps" };
+		std::size_t count = 0;
+		for (auto window : ez::windows<2>(source)) {
+			CHECK(window[0] == words[count]);
+			CHECK(window[1] == words[count + 1]);
+			++count;
+		}
+		CHECK(count == 4);
+	}
+	fmt::print("String stream window test passed\n");
+
+	{ // Adjacent pairs
+		int count = 0;
+		for (auto&& [prev, next] : ez::adjacent(values)) {
+			CHECK(&prev == &values[count]);
+			CHECK(next - prev == 2 * count + 1);
+			++count;
+		}
+		CHECK(count == 9);
+
+		std::istringstream stream("0 1 4 9 16 25 36 49 64 81");
+		stream_range<std::istream_iterator<int>> source{ std::istream_iterator<int>(stream), std::istream_iterator<int>() };
+
+		count = 0;
+		for (auto&& [prev, next] : ez::adjacent(source)) {
+			CHECK(next - prev == 2 * count + 1);
+			++count;
+		}
+		CHECK(count == 9);
+	}
+	fmt::print("Adjacent pair test passed\n");
+
+	fmt::print("End test_windows()\n");
+}